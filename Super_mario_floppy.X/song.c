@@ -0,0 +1,318 @@
+#include "engine.h"
+
+const note_t song[] = { //{frequency, ms}, 0 Hz is a rest
+    {660, 100},
+    {0, 150},
+    {660, 100},
+    {0, 300},
+    {660, 100},
+    {0, 300},
+    {510, 100},
+    {0, 100},
+    {660, 100},
+    {0, 300},
+    {770, 100},
+    {0, 550},
+    {380, 100},
+    {0, 575},
+    {510, 100},
+    {0, 450},
+    {380, 100},
+    {0, 400},
+    {320, 100},
+    {0, 500},
+    {440, 100},
+    {0, 300},
+    {480, 80},
+    {0, 330},
+    {450, 100},
+    {0, 150},
+    {430, 100},
+    {0, 300},
+    {380, 100},
+    {0, 200},
+    {660, 80},
+    {0, 200},
+    {760, 50},
+    {0, 150},
+    {860, 100},
+    {0, 300},
+    {700, 80},
+    {0, 150},
+    {760, 50},
+    {0, 350},
+    {660, 80},
+    {0, 300},
+    {520, 80},
+    {0, 150},
+    {580, 80},
+    {0, 150},
+    {480, 80},
+    {0, 500},
+    {510, 100},
+    {0, 450},
+    {380, 100},
+    {0, 400},
+    {320, 100},
+    {0, 500},
+    {440, 100},
+    {0, 300},
+    {480, 80},
+    {0, 330},
+    {450, 100},
+    {0, 150},
+    {430, 100},
+    {0, 300},
+    {380, 100},
+    {0, 200},
+    {660, 80},
+    {0, 200},
+    {760, 50},
+    {0, 150},
+    {860, 100},
+    {0, 300},
+    {700, 80},
+    {0, 150},
+    {760, 50},
+    {0, 350},
+    {660, 80},
+    {0, 300},
+    {520, 80},
+    {0, 150},
+    {580, 80},
+    {0, 150},
+    {480, 80},
+    {0, 500},
+    {500, 100},
+    {0, 300},
+    {760, 100},
+    {0, 100},
+    {720, 100},
+    {0, 150},
+    {680, 100},
+    {0, 150},
+    {620, 150},
+    {0, 300},
+    {650, 150},
+    {0, 300},
+    {380, 100},
+    {0, 150},
+    {430, 100},
+    {0, 150},
+    {500, 100},
+    {0, 300},
+    {430, 100},
+    {0, 150},
+    {500, 100},
+    {0, 100},
+    {570, 100},
+    {0, 220},
+    {500, 100},
+    {0, 300},
+    {760, 100},
+    {0, 100},
+    {720, 100},
+    {0, 150},
+    {680, 100},
+    {0, 150},
+    {620, 150},
+    {0, 300},
+    {650, 200},
+    {0, 300},
+    {1020, 80},
+    {0, 300},
+    {1020, 80},
+    {0, 150},
+    {1020, 80},
+    {0, 300},
+    {380, 100},
+    {0, 300},
+    {500, 100},
+    {0, 300},
+    {760, 100},
+    {0, 100},
+    {720, 100},
+    {0, 150},
+    {680, 100},
+    {0, 150},
+    {620, 150},
+    {0, 300},
+    {650, 150},
+    {0, 300},
+    {380, 100},
+    {0, 150},
+    {430, 100},
+    {0, 150},
+    {500, 100},
+    {0, 300},
+    {430, 100},
+    {0, 150},
+    {500, 100},
+    {0, 100},
+    {570, 100},
+    {0, 420},
+    {585, 100},
+    {0, 450},
+    {550, 100},
+    {0, 420},
+    {500, 100},
+    {0, 360},
+    {380, 100},
+    {0, 300},
+    {500, 100},
+    {0, 300},
+    {500, 100},
+    {0, 150},
+    {500, 100},
+    {0, 300},
+    {500, 100},
+    {0, 300},
+    {760, 100},
+    {0, 100},
+    {720, 100},
+    {0, 150},
+    {680, 100},
+    {0, 150},
+    {620, 150},
+    {0, 300},
+    {650, 150},
+    {0, 300},
+    {380, 100},
+    {0, 150},
+    {430, 100},
+    {0, 150},
+    {500, 100},
+    {0, 300},
+    {430, 100},
+    {0, 150},
+    {500, 100},
+    {0, 100},
+    {570, 100},
+    {0, 220},
+    {500, 100},
+    {0, 300},
+    {760, 100},
+    {0, 100},
+    {720, 100},
+    {0, 150},
+    {680, 100},
+    {0, 150},
+    {620, 150},
+    {0, 300},
+    {650, 200},
+    {0, 300},
+    {1020, 80},
+    {0, 300},
+    {1020, 80},
+    {0, 150},
+    {1020, 80},
+    {0, 300},
+    {380, 100},
+    {0, 300},
+    {500, 100},
+    {0, 300},
+    {760, 100},
+    {0, 100},
+    {720, 100},
+    {0, 150},
+    {680, 100},
+    {0, 150},
+    {620, 150},
+    {0, 300},
+    {650, 150},
+    {0, 300},
+    {380, 100},
+    {0, 150},
+    {430, 100},
+    {0, 150},
+    {500, 100},
+    {0, 300},
+    {430, 100},
+    {0, 150},
+    {500, 100},
+    {0, 100},
+    {570, 100},
+    {0, 420},
+    {585, 100},
+    {0, 450},
+    {550, 100},
+    {0, 420},
+    {500, 100},
+    {0, 360},
+    {380, 100},
+    {0, 300},
+    {500, 100},
+    {0, 300},
+    {500, 100},
+    {0, 150},
+    {500, 100},
+    {0, 300},
+    {500, 60},
+    {0, 150},
+    {500, 80},
+    {0, 300},
+    {500, 60},
+    {0, 350},
+    {500, 80},
+    {0, 150},
+    {580, 80},
+    {0, 350},
+    {660, 80},
+    {0, 150},
+    {500, 80},
+    {0, 300},
+    {430, 80},
+    {0, 150},
+    {380, 80},
+    {0, 600},
+    {500, 60},
+    {0, 150},
+    {500, 80},
+    {0, 300},
+    {500, 60},
+    {0, 350},
+    {500, 80},
+    {0, 150},
+    {580, 80},
+    {0, 150},
+    {660, 80},
+    {0, 550},
+    {870, 80},
+    {0, 325},
+    {760, 80},
+    {0, 600},
+    {500, 60},
+    {0, 150},
+    {500, 80},
+    {0, 300},
+    {500, 60},
+    {0, 350},
+    {500, 80},
+    {0, 150},
+    {580, 80},
+    {0, 350},
+    {660, 80},
+    {0, 150},
+    {500, 80},
+    {0, 300},
+    {430, 80},
+    {0, 150},
+    {380, 80},
+    {0, 600},
+    {660, 100},
+    {0, 150},
+    {660, 100},
+    {0, 300},
+    {660, 100},
+    {0, 300},
+    {510, 100},
+    {0, 100},
+    {660, 100},
+    {0, 300},
+    {770, 100},
+    {0, 550},
+    {380, 100},
+    {0, 575},
+};
+
+const uint16_t song_length = sizeof (song) / sizeof (song[0]);
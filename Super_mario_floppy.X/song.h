@@ -0,0 +1,9 @@
+#ifndef SONG_H
+#define SONG_H
+
+#define SONG_TITLE "Super Mario Bros Theme."
+#define FREQ_DIVISOR 2 //step frequency = song frequency / FREQ_DIVISOR
+#define REVERSE_STEPS 150 //LA0 toggles between two head direction inversions
+#define HOMING 0 //the song starts from the head position left at power up
+
+#endif
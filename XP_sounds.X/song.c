@@ -0,0 +1,23 @@
+#include "engine.h"
+
+const note_t song[] = { //{frequency, ms}, 0 Hz is a rest
+    {622, 125},
+    {0, 125},
+    {311, 125},
+    {466, 375},
+    {415, 125},
+    {0, 375},
+    {622, 125},
+    {0, 125},
+    {466, 500},
+    {0, 1000},
+    {830, 125},
+    {0, 125},
+    {622, 125},
+    {0, 125},
+    {415, 125},
+    {0, 125},
+    {466, 125},
+};
+
+const uint16_t song_length = sizeof (song) / sizeof (song[0]);
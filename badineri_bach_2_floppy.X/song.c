@@ -0,0 +1,856 @@
+#include "engine.h"
+
+const note_t song[] = { //{frequency, ms}, 0 Hz is a rest
+    {987, 177},
+    {0, 62},
+    {1174, 85},
+    {0, 33},
+    {987, 56},
+    {0, 81},
+    {739, 204},
+    {0, 37},
+    {987, 70},
+    {0, 43},
+    {739, 62},
+    {0, 91},
+    {587, 197},
+    {0, 54},
+    {739, 56},
+    {0, 39},
+    {587, 72},
+    {0, 64},
+    {493, 272},
+    {0, 218},
+    {369, 112},
+    {0, 16},
+    {493, 87},
+    {0, 54},
+    {587, 104},
+    {0, 2},
+    {493, 72},
+    {0, 60},
+    {554, 100},
+    {0, 12},
+    {493, 77},
+    {0, 60},
+    {554, 104},
+    {0, 6},
+    {493, 93},
+    {0, 52},
+    {466, 87},
+    {0, 22},
+    {554, 102},
+    {0, 22},
+    {659, 100},
+    {0, 18},
+    {554, 77},
+    {0, 60},
+    {587, 108},
+    {0, 141},
+    {493, 83},
+    {0, 166},
+    {987, 208},
+    {0, 31},
+    {1174, 87},
+    {0, 25},
+    {987, 60},
+    {0, 87},
+    {739, 208},
+    {0, 47},
+    {987, 66},
+    {0, 33},
+    {739, 75},
+    {0, 68},
+    {587, 202},
+    {0, 47},
+    {739, 77},
+    {0, 41},
+    {587, 75},
+    {0, 60},
+    {493, 329},
+    {0, 164},
+    {587, 125},
+    {0, 120},
+    {587, 127},
+    {0, 131},
+    {587, 122},
+    {0, 135},
+    {587, 127},
+    {0, 127},
+    {987, 100},
+    {0, 131},
+    {587, 131},
+    {0, 125},
+    {659, 60},
+    {0, 50},
+    {659, 61},
+    {0, 72},
+    {554, 155},
+    {0, 102},
+    {739, 116},
+    {0, 141},
+    {739, 112},
+    {0, 141},
+    {739, 112},
+    {0, 131},
+    {739, 116},
+    {0, 133},
+    {1174, 118},
+    {0, 133},
+    {739, 143},
+    {0, 100},
+    {830, 59},
+    {0, 68},
+    {830, 84},
+    {0, 22},
+    {698, 136},
+    {0, 137},
+    {554, 114},
+    {0, 131},
+    {880, 81},
+    {0, 31},
+    {739, 83},
+    {0, 50},
+    {830, 102},
+    {0, 8},
+    {739, 66},
+    {0, 52},
+    {830, 100},
+    {0, 25},
+    {739, 83},
+    {0, 37},
+    {698, 100},
+    {0, 29},
+    {830, 72},
+    {0, 50},
+    {987, 95},
+    {0, 27},
+    {830, 62},
+    {0, 64},
+    {880, 89},
+    {0, 39},
+    {830, 66},
+    {0, 56},
+    {880, 89},
+    {0, 41},
+    {830, 72},
+    {0, 60},
+    {739, 66},
+    {0, 54},
+    {880, 60},
+    {0, 66},
+    {739, 141},
+    {0, 99},
+    {739, 68},
+    {0, 58},
+    {987, 66},
+    {0, 58},
+    {739, 151},
+    {0, 108},
+    {739, 56},
+    {0, 64},
+    {1108, 89},
+    {0, 29},
+    {739, 122},
+    {0, 2},
+    {698, 142},
+    {0, 101},
+    {1174, 75},
+    {0, 45},
+    {739, 106},
+    {0, 10},
+    {698, 155},
+    {0, 90},
+    {1174, 79},
+    {0, 43},
+    {1108, 75},
+    {0, 54},
+    {987, 95},
+    {0, 54},
+    {1108, 79},
+    {0, 39},
+    {880, 81},
+    {0, 43},
+    {830, 56},
+    {0, 41},
+    {739, 85},
+    {0, 70},
+    {880, 102},
+    {0, 147},
+    {880, 53},
+    {0, 45},
+    {880, 65},
+    {0, 72},
+    {739, 218},
+    {0, 295},
+    {987, 177},
+    {0, 62},
+    {1174, 85},
+    {0, 33},
+    {987, 56},
+    {0, 81},
+    {739, 204},
+    {0, 37},
+    {987, 70},
+    {0, 43},
+    {739, 62},
+    {0, 91},
+    {587, 197},
+    {0, 54},
+    {739, 56},
+    {0, 39},
+    {587, 72},
+    {0, 64},
+    {493, 272},
+    {0, 218},
+    {369, 112},
+    {0, 16},
+    {493, 87},
+    {0, 54},
+    {587, 104},
+    {0, 2},
+    {493, 72},
+    {0, 60},
+    {554, 100},
+    {0, 12},
+    {493, 77},
+    {0, 60},
+    {554, 104},
+    {0, 6},
+    {493, 93},
+    {0, 52},
+    {466, 87},
+    {0, 22},
+    {554, 102},
+    {0, 22},
+    {659, 100},
+    {0, 18},
+    {554, 77},
+    {0, 60},
+    {587, 108},
+    {0, 141},
+    {493, 83},
+    {0, 166},
+    {987, 208},
+    {0, 31},
+    {1174, 87},
+    {0, 25},
+    {987, 60},
+    {0, 87},
+    {739, 208},
+    {0, 47},
+    {987, 66},
+    {0, 33},
+    {739, 75},
+    {0, 68},
+    {587, 202},
+    {0, 47},
+    {739, 77},
+    {0, 41},
+    {587, 75},
+    {0, 60},
+    {493, 329},
+    {0, 164},
+    {587, 125},
+    {0, 120},
+    {587, 127},
+    {0, 131},
+    {587, 122},
+    {0, 135},
+    {587, 127},
+    {0, 127},
+    {987, 100},
+    {0, 131},
+    {587, 131},
+    {0, 125},
+    {659, 60},
+    {0, 50},
+    {659, 61},
+    {0, 72},
+    {554, 155},
+    {0, 102},
+    {739, 116},
+    {0, 141},
+    {739, 112},
+    {0, 141},
+    {739, 112},
+    {0, 131},
+    {739, 116},
+    {0, 133},
+    {1174, 118},
+    {0, 133},
+    {739, 143},
+    {0, 100},
+    {830, 59},
+    {0, 68},
+    {830, 84},
+    {0, 22},
+    {698, 136},
+    {0, 137},
+    {554, 114},
+    {0, 131},
+    {880, 81},
+    {0, 31},
+    {739, 83},
+    {0, 50},
+    {830, 102},
+    {0, 8},
+    {739, 66},
+    {0, 52},
+    {830, 100},
+    {0, 25},
+    {739, 83},
+    {0, 37},
+    {698, 100},
+    {0, 29},
+    {830, 72},
+    {0, 50},
+    {987, 95},
+    {0, 27},
+    {830, 62},
+    {0, 64},
+    {880, 89},
+    {0, 39},
+    {830, 66},
+    {0, 56},
+    {880, 89},
+    {0, 41},
+    {830, 72},
+    {0, 60},
+    {739, 66},
+    {0, 54},
+    {880, 60},
+    {0, 66},
+    {739, 141},
+    {0, 99},
+    {739, 68},
+    {0, 58},
+    {987, 66},
+    {0, 58},
+    {739, 151},
+    {0, 108},
+    {739, 56},
+    {0, 64},
+    {1108, 89},
+    {0, 29},
+    {739, 122},
+    {0, 2},
+    {698, 142},
+    {0, 101},
+    {1174, 75},
+    {0, 45},
+    {739, 106},
+    {0, 10},
+    {698, 155},
+    {0, 90},
+    {1174, 79},
+    {0, 43},
+    {1108, 75},
+    {0, 54},
+    {987, 95},
+    {0, 54},
+    {1108, 79},
+    {0, 39},
+    {880, 81},
+    {0, 43},
+    {830, 56},
+    {0, 41},
+    {739, 85},
+    {0, 70},
+    {880, 102},
+    {0, 147},
+    {880, 53},
+    {0, 45},
+    {880, 65},
+    {0, 72},
+    {739, 218},
+    {0, 306},
+    {739, 197},
+    {0, 50},
+    {880, 83},
+    {0, 41},
+    {739, 52},
+    {0, 72},
+    {554, 227},
+    {0, 18},
+    {739, 79},
+    {0, 43},
+    {554, 83},
+    {0, 56},
+    {440, 210},
+    {0, 41},
+    {554, 64},
+    {0, 22},
+    {440, 100},
+    {0, 52},
+    {369, 254},
+    {0, 239},
+    {523, 258},
+    {0, 233},
+    {659, 225},
+    {0, 27},
+    {622, 97},
+    {0, 14},
+    {739, 75},
+    {0, 62},
+    {880, 156},
+    {0, 72},
+    {783, 75},
+    {0, 41},
+    {739, 72},
+    {0, 66},
+    {783, 91},
+    {0, 172},
+    {659, 83},
+    {0, 168},
+    {783, 218},
+    {0, 25},
+    {987, 81},
+    {0, 31},
+    {783, 68},
+    {0, 66},
+    {659, 200},
+    {0, 56},
+    {783, 77},
+    {0, 37},
+    {659, 68},
+    {0, 66},
+    {554, 208},
+    {0, 45},
+    {659, 81},
+    {0, 27},
+    {554, 72},
+    {0, 66},
+    {440, 500},
+    {0, 112},
+    {587, 87},
+    {0, 33},
+    {739, 60},
+    {0, 60},
+    {587, 77},
+    {0, 54},
+    {659, 120},
+    {0, 8},
+    {587, 77},
+    {0, 56},
+    {659, 110},
+    {0, 135},
+    {554, 97},
+    {0, 16},
+    {659, 116},
+    {0, 14},
+    {783, 91},
+    {0, 22},
+    {659, 95},
+    {0, 33},
+    {739, 83},
+    {0, 31},
+    {659, 89},
+    {0, 37},
+    {739, 100},
+    {0, 31},
+    {659, 77},
+    {0, 45},
+    {587, 91},
+    {0, 25},
+    {739, 62},
+    {0, 54},
+    {587, 149},
+    {0, 112},
+    {587, 68},
+    {0, 56},
+    {783, 126},
+    {0, 125},
+    {554, 130},
+    {0, 114},
+    {880, 100},
+    {0, 27},
+    {587, 132},
+    {0, 116},
+    {587, 68},
+    {0, 54},
+    {987, 97},
+    {0, 35},
+    {587, 110},
+    {0, 16},
+    {554, 127},
+    {0, 4},
+    {587, 70},
+    {0, 56},
+    {987, 81},
+    {0, 43},
+    {880, 104},
+    {0, 27},
+    {783, 64},
+    {0, 60},
+    {880, 95},
+    {0, 20},
+    {739, 91},
+    {0, 33},
+    {659, 89},
+    {0, 16},
+    {587, 97},
+    {0, 47},
+    {739, 139},
+    {0, 95},
+    {739, 58},
+    {0, 62},
+    {739, 77},
+    {0, 56},
+    {587, 304},
+    {0, 210},
+    {739, 100},
+    {0, 145},
+    {739, 108},
+    {0, 150},
+    {739, 97},
+    {0, 150},
+    {739, 106},
+    {0, 147},
+    {1174, 93},
+    {0, 145},
+    {739, 131},
+    {0, 129},
+    {783, 66},
+    {0, 56},
+    {783, 67},
+    {0, 50},
+    {659, 143},
+    {0, 116},
+    {659, 120},
+    {0, 137},
+    {659, 114},
+    {0, 122},
+    {659, 120},
+    {0, 129},
+    {659, 131},
+    {0, 112},
+    {1108, 93},
+    {0, 147},
+    {659, 125},
+    {0, 106},
+    {739, 62},
+    {0, 54},
+    {739, 89},
+    {0, 41},
+    {587, 145},
+    {0, 125},
+    {987, 114},
+    {0, 120},
+    {1174, 79},
+    {0, 41},
+    {987, 64},
+    {0, 58},
+    {880, 255},
+    {0, 516},
+    {987, 110},
+    {0, 12},
+    {783, 63},
+    {0, 74},
+    {659, 572},
+    {0, 166},
+    {783, 116},
+    {0, 2},
+    {659, 71},
+    {0, 75},
+    {523, 91},
+    {0, 27},
+    {659, 93},
+    {0, 12},
+    {783, 97},
+    {0, 20},
+    {659, 62},
+    {0, 60},
+    {523, 120},
+    {0, 122},
+    {523, 126},
+    {0, 141},
+    {466, 100},
+    {0, 150},
+    {369, 110},
+    {0, 147},
+    {391, 229},
+    {0, 31},
+    {369, 89},
+    {0, 143},
+    {493, 187},
+    {0, 52},
+    {466, 97},
+    {0, 27},
+    {554, 83},
+    {0, 47},
+    {659, 202},
+    {0, 47},
+    {587, 87},
+    {0, 22},
+    {554, 81},
+    {0, 56},
+    {587, 183},
+    {0, 68},
+    {493, 107},
+    {0, 53},
+    {659, 101},
+    {0, 239},
+    {587, 95},
+    {0, 14},
+    {739, 85},
+    {0, 50},
+    {987, 100},
+    {0, 156},
+    {739, 70},
+    {0, 187},
+    {659, 81},
+    {0, 14},
+    {587, 114},
+    {0, 25},
+    {554, 89},
+    {0, 31},
+    {587, 52},
+    {0, 91},
+    {554, 261},
+    {0, 252},
+    {739, 197},
+    {0, 50},
+    {880, 83},
+    {0, 41},
+    {739, 52},
+    {0, 72},
+    {554, 227},
+    {0, 18},
+    {739, 79},
+    {0, 43},
+    {554, 83},
+    {0, 56},
+    {440, 210},
+    {0, 41},
+    {554, 64},
+    {0, 22},
+    {440, 100},
+    {0, 52},
+    {369, 254},
+    {0, 239},
+    {523, 258},
+    {0, 233},
+    {659, 225},
+    {0, 27},
+    {622, 97},
+    {0, 14},
+    {739, 75},
+    {0, 62},
+    {880, 156},
+    {0, 72},
+    {783, 75},
+    {0, 41},
+    {739, 72},
+    {0, 66},
+    {783, 91},
+    {0, 172},
+    {659, 83},
+    {0, 168},
+    {783, 218},
+    {0, 25},
+    {987, 81},
+    {0, 31},
+    {783, 68},
+    {0, 66},
+    {659, 200},
+    {0, 56},
+    {783, 77},
+    {0, 37},
+    {659, 68},
+    {0, 66},
+    {554, 208},
+    {0, 45},
+    {659, 81},
+    {0, 27},
+    {554, 72},
+    {0, 66},
+    {440, 500},
+    {0, 112},
+    {587, 87},
+    {0, 33},
+    {739, 60},
+    {0, 60},
+    {587, 77},
+    {0, 54},
+    {659, 120},
+    {0, 8},
+    {587, 77},
+    {0, 56},
+    {659, 110},
+    {0, 135},
+    {554, 97},
+    {0, 16},
+    {659, 116},
+    {0, 14},
+    {783, 91},
+    {0, 22},
+    {659, 95},
+    {0, 33},
+    {739, 83},
+    {0, 31},
+    {659, 89},
+    {0, 37},
+    {739, 100},
+    {0, 31},
+    {659, 77},
+    {0, 45},
+    {587, 91},
+    {0, 25},
+    {739, 62},
+    {0, 54},
+    {587, 149},
+    {0, 112},
+    {587, 68},
+    {0, 56},
+    {783, 126},
+    {0, 125},
+    {554, 130},
+    {0, 114},
+    {880, 100},
+    {0, 27},
+    {587, 132},
+    {0, 116},
+    {587, 68},
+    {0, 54},
+    {987, 97},
+    {0, 35},
+    {587, 110},
+    {0, 16},
+    {554, 127},
+    {0, 4},
+    {587, 70},
+    {0, 56},
+    {987, 81},
+    {0, 43},
+    {880, 104},
+    {0, 27},
+    {783, 64},
+    {0, 60},
+    {880, 95},
+    {0, 20},
+    {739, 91},
+    {0, 33},
+    {659, 89},
+    {0, 16},
+    {587, 97},
+    {0, 47},
+    {739, 139},
+    {0, 95},
+    {739, 58},
+    {0, 62},
+    {739, 77},
+    {0, 56},
+    {587, 304},
+    {0, 210},
+    {739, 100},
+    {0, 145},
+    {739, 108},
+    {0, 150},
+    {739, 97},
+    {0, 150},
+    {739, 106},
+    {0, 147},
+    {1174, 93},
+    {0, 145},
+    {739, 131},
+    {0, 129},
+    {783, 66},
+    {739, 64},
+    {0, 43},
+    {739, 91},
+    {0, 234},
+    {659, 120},
+    {0, 137},
+    {659, 114},
+    {0, 122},
+    {659, 120},
+    {0, 129},
+    {659, 131},
+    {0, 112},
+    {1108, 93},
+    {0, 147},
+    {659, 125},
+    {0, 106},
+    {739, 62},
+    {0, 54},
+    {739, 89},
+    {0, 41},
+    {587, 145},
+    {0, 125},
+    {987, 114},
+    {0, 120},
+    {1174, 79},
+    {0, 41},
+    {987, 64},
+    {0, 58},
+    {880, 255},
+    {0, 516},
+    {987, 110},
+    {0, 12},
+    {783, 63},
+    {0, 74},
+    {659, 572},
+    {0, 166},
+    {783, 116},
+    {0, 2},
+    {659, 71},
+    {0, 75},
+    {523, 91},
+    {0, 27},
+    {659, 93},
+    {0, 12},
+    {783, 97},
+    {0, 20},
+    {659, 62},
+    {0, 60},
+    {523, 120},
+    {0, 122},
+    {523, 126},
+    {0, 141},
+    {466, 100},
+    {0, 150},
+    {369, 110},
+    {0, 147},
+    {391, 229},
+    {0, 31},
+    {369, 89},
+    {0, 143},
+    {493, 187},
+    {0, 52},
+    {466, 97},
+    {0, 27},
+    {554, 83},
+    {0, 47},
+    {659, 202},
+    {0, 47},
+    {587, 87},
+    {0, 22},
+    {554, 81},
+    {0, 56},
+    {587, 183},
+    {0, 68},
+    {493, 107},
+    {0, 53},
+    {659, 101},
+    {0, 239},
+    {587, 95},
+    {0, 14},
+    {739, 85},
+    {0, 50},
+    {987, 100},
+    {0, 156},
+    {739, 70},
+    {0, 187},
+    {659, 81},
+    {0, 14},
+    {587, 114},
+    {0, 25},
+    {554, 89},
+    {0, 31},
+    {587, 52},
+    {0, 91},
+    {554, 261},
+};
+
+const uint16_t song_length = sizeof (song) / sizeof (song[0]);
@@ -0,0 +1,879 @@
+#include "engine.h"
+
+const note_t song[] = { //{frequency, ms}, 0 Hz is a rest
+    {123, 122},
+    {0, 120},
+    {1174, 86},
+    {0, 31},
+    {987, 57},
+    {0, 70},
+    {146, 109},
+    {0, 134},
+    {123, 125},
+    {0, 103},
+    {587, 156},
+    {0, 90},
+    {146, 144},
+    {0, 118},
+    {493, 179},
+    {0, 70},
+    {184, 122},
+    {0, 129},
+    {369, 114},
+    {0, 14},
+    {493, 88},
+    {0, 22},
+    {123, 121},
+    {0, 12},
+    {493, 74},
+    {0, 31},
+    {391, 138},
+    {493, 78},
+    {0, 45},
+    {493, 146},
+    {0, 97},
+    {554, 125},
+    {0, 6},
+    {554, 102},
+    {0, 20},
+    {659, 101},
+    {0, 16},
+    {554, 78},
+    {0, 54},
+    {493, 131},
+    {0, 101},
+    {146, 90},
+    {0, 32},
+    {138, 87},
+    {0, 50},
+    {123, 118},
+    {0, 124},
+    {1174, 89},
+    {0, 22},
+    {987, 62},
+    {0, 85},
+    {739, 207},
+    {0, 27},
+    {123, 123},
+    {0, 126},
+    {587, 139},
+    {0, 102},
+    {146, 132},
+    {0, 2},
+    {587, 77},
+    {0, 29},
+    {293, 185},
+    {0, 87},
+    {184, 118},
+    {0, 120},
+    {369, 126},
+    {0, 117},
+    {587, 309},
+    {0, 60},
+    {554, 100},
+    {0, 22},
+    {587, 305},
+    {0, 68},
+    {987, 78},
+    {0, 43},
+    {587, 193},
+    {0, 50},
+    {440, 133},
+    {0, 2},
+    {659, 56},
+    {0, 60},
+    {329, 118},
+    {0, 121},
+    {440, 131},
+    {0, 123},
+    {587, 123},
+    {0, 8},
+    {293, 87},
+    {0, 25},
+    {415, 148},
+    {0, 94},
+    {587, 116},
+    {0, 2},
+    {246, 86},
+    {0, 37},
+    {587, 115},
+    {1174, 90},
+    {0, 35},
+    {739, 173},
+    {0, 80},
+    {830, 54},
+    {0, 18},
+    {739, 72},
+    {0, 6},
+    {830, 85},
+    {0, 6},
+    {415, 127},
+    {0, 124},
+    {739, 122},
+    {0, 18},
+    {739, 89},
+    {0, 18},
+    {739, 119},
+    {0, 22},
+    {739, 85},
+    {0, 16},
+    {246, 121},
+    {0, 18},
+    {739, 67},
+    {0, 47},
+    {207, 117},
+    {0, 8},
+    {739, 85},
+    {0, 35},
+    {698, 101},
+    {0, 26},
+    {830, 74},
+    {0, 43},
+    {987, 109},
+    {0, 16},
+    {830, 64},
+    {0, 58},
+    {184, 113},
+    {0, 18},
+    {830, 68},
+    {0, 45},
+    {739, 128},
+    {0, 10},
+    {830, 74},
+    {0, 27},
+    {739, 118},
+    {0, 30},
+    {880, 61},
+    {0, 43},
+    {554, 119},
+    {0, 10},
+    {698, 118},
+    {0, 10},
+    {739, 107},
+    {0, 20},
+    {987, 67},
+    {0, 56},
+    {493, 122},
+    {0, 123},
+    {739, 107},
+    {0, 25},
+    {1108, 90},
+    {0, 27},
+    {739, 124},
+    {698, 144},
+    {0, 99},
+    {1174, 75},
+    {0, 41},
+    {293, 123},
+    {0, 120},
+    {246, 124},
+    {0, 115},
+    {1108, 76},
+    {0, 52},
+    {987, 96},
+    {0, 20},
+    {739, 115},
+    {0, 33},
+    {880, 82},
+    {0, 27},
+    {830, 119},
+    {0, 129},
+    {440, 121},
+    {0, 130},
+    {554, 108},
+    {0, 2},
+    {880, 67},
+    {0, 70},
+    {739, 220},
+    {0, 287},
+    {123, 122},
+    {0, 120},
+    {1174, 86},
+    {0, 31},
+    {987, 57},
+    {0, 70},
+    {146, 109},
+    {0, 134},
+    {123, 125},
+    {0, 103},
+    {587, 156},
+    {0, 90},
+    {146, 144},
+    {0, 118},
+    {493, 179},
+    {0, 70},
+    {184, 122},
+    {0, 129},
+    {369, 114},
+    {0, 14},
+    {493, 88},
+    {0, 22},
+    {123, 121},
+    {0, 12},
+    {493, 74},
+    {0, 31},
+    {391, 138},
+    {493, 78},
+    {0, 45},
+    {493, 146},
+    {0, 97},
+    {554, 125},
+    {0, 6},
+    {554, 102},
+    {0, 20},
+    {659, 101},
+    {0, 16},
+    {554, 78},
+    {0, 54},
+    {493, 131},
+    {0, 101},
+    {146, 90},
+    {0, 32},
+    {138, 87},
+    {0, 50},
+    {123, 118},
+    {0, 124},
+    {1174, 89},
+    {0, 22},
+    {987, 62},
+    {0, 85},
+    {739, 207},
+    {0, 27},
+    {123, 123},
+    {0, 126},
+    {587, 139},
+    {0, 102},
+    {146, 132},
+    {0, 2},
+    {587, 77},
+    {0, 29},
+    {293, 185},
+    {0, 87},
+    {184, 118},
+    {0, 120},
+    {369, 126},
+    {0, 117},
+    {587, 309},
+    {0, 60},
+    {554, 100},
+    {0, 22},
+    {587, 305},
+    {0, 68},
+    {987, 78},
+    {0, 43},
+    {587, 193},
+    {0, 50},
+    {440, 133},
+    {0, 2},
+    {659, 56},
+    {0, 60},
+    {329, 118},
+    {0, 121},
+    {440, 131},
+    {0, 123},
+    {587, 123},
+    {0, 8},
+    {293, 87},
+    {0, 25},
+    {415, 148},
+    {0, 94},
+    {587, 116},
+    {0, 2},
+    {246, 86},
+    {0, 37},
+    {587, 115},
+    {1174, 90},
+    {0, 35},
+    {739, 173},
+    {0, 80},
+    {830, 54},
+    {0, 18},
+    {739, 72},
+    {0, 6},
+    {830, 85},
+    {0, 6},
+    {415, 127},
+    {0, 124},
+    {739, 122},
+    {0, 18},
+    {739, 89},
+    {0, 18},
+    {739, 119},
+    {0, 22},
+    {739, 85},
+    {0, 16},
+    {246, 121},
+    {0, 18},
+    {739, 67},
+    {0, 47},
+    {207, 117},
+    {0, 8},
+    {739, 85},
+    {0, 35},
+    {698, 101},
+    {0, 26},
+    {830, 74},
+    {0, 43},
+    {987, 109},
+    {0, 16},
+    {830, 64},
+    {0, 58},
+    {184, 113},
+    {0, 18},
+    {830, 68},
+    {0, 45},
+    {739, 128},
+    {0, 10},
+    {830, 74},
+    {0, 27},
+    {739, 118},
+    {0, 30},
+    {880, 61},
+    {0, 43},
+    {554, 119},
+    {0, 10},
+    {698, 118},
+    {0, 10},
+    {739, 107},
+    {0, 20},
+    {987, 67},
+    {0, 56},
+    {493, 122},
+    {0, 123},
+    {739, 107},
+    {0, 25},
+    {1108, 90},
+    {0, 27},
+    {739, 124},
+    {698, 144},
+    {0, 99},
+    {1174, 75},
+    {0, 41},
+    {293, 123},
+    {0, 120},
+    {246, 124},
+    {0, 115},
+    {1108, 76},
+    {0, 52},
+    {987, 96},
+    {0, 20},
+    {739, 115},
+    {0, 33},
+    {880, 82},
+    {0, 27},
+    {830, 119},
+    {0, 129},
+    {440, 121},
+    {0, 130},
+    {554, 108},
+    {0, 2},
+    {880, 67},
+    {0, 70},
+    {739, 220},
+    {0, 281},
+    {440, 156},
+    {0, 108},
+    {880, 85},
+    {0, 39},
+    {739, 54},
+    {0, 41},
+    {369, 170},
+    {0, 81},
+    {92, 105},
+    {0, 37},
+    {554, 85},
+    {0, 20},
+    {440, 181},
+    {0, 72},
+    {110, 109},
+    {0, 6},
+    {440, 102},
+    {0, 29},
+    {220, 174},
+    {0, 77},
+    {220, 94},
+    {184, 91},
+    {0, 56},
+    {369, 186},
+    {0, 60},
+    {493, 159},
+    {0, 86},
+    {123, 218},
+    {0, 32},
+    {123, 207},
+    {0, 41},
+    {123, 181},
+    {0, 47},
+    {123, 163},
+    {0, 93},
+    {164, 167},
+    {0, 74},
+    {246, 106},
+    {0, 6},
+    {195, 89},
+    {0, 45},
+    {164, 187},
+    {0, 63},
+    {195, 111},
+    {0, 22},
+    {783, 70},
+    {0, 54},
+    {138, 155},
+    {0, 109},
+    {110, 143},
+    {0, 88},
+    {659, 183},
+    {0, 67},
+    {138, 126},
+    {0, 132},
+    {329, 196},
+    {0, 43},
+    {164, 170},
+    {0, 81},
+    {184, 150},
+    {0, 91},
+    {739, 62},
+    {0, 58},
+    {587, 78},
+    {0, 47},
+    {493, 113},
+    {0, 18},
+    {587, 78},
+    {0, 27},
+    {391, 128},
+    {0, 4},
+    {587, 107},
+    {0, 14},
+    {220, 131},
+    {0, 120},
+    {440, 133},
+    {0, 115},
+    {739, 84},
+    {0, 29},
+    {659, 90},
+    {0, 33},
+    {440, 125},
+    {0, 6},
+    {659, 78},
+    {0, 43},
+    {587, 93},
+    {0, 22},
+    {739, 64},
+    {0, 51},
+    {587, 150},
+    {0, 110},
+    {587, 69},
+    {0, 54},
+    {783, 127},
+    {0, 4},
+    {195, 126},
+    {0, 118},
+    {369, 177},
+    {0, 59},
+    {220, 126},
+    {0, 2},
+    {554, 132},
+    {391, 193},
+    {0, 38},
+    {246, 134},
+    {0, 6},
+    {554, 128},
+    {0, 2},
+    {587, 72},
+    {0, 52},
+    {987, 83},
+    {0, 14},
+    {164, 130},
+    {0, 26},
+    {783, 66},
+    {0, 31},
+    {369, 143},
+    {0, 101},
+    {493, 139},
+    {0, 104},
+    {440, 123},
+    {0, 131},
+    {391, 128},
+    {0, 43},
+    {659, 79},
+    {0, 2},
+    {146, 138},
+    {0, 122},
+    {110, 110},
+    {0, 120},
+    {73, 137},
+    {0, 113},
+    {739, 316},
+    {0, 49},
+    {659, 80},
+    {0, 50},
+    {440, 119},
+    {0, 119},
+    {146, 164},
+    {0, 79},
+    {739, 195},
+    {0, 58},
+    {659, 74},
+    {0, 12},
+    {739, 65},
+    {587, 101},
+    {0, 4},
+    {659, 143},
+    {0, 95},
+    {116, 119},
+    {0, 132},
+    {659, 316},
+    {0, 41},
+    {587, 90},
+    {0, 37},
+    {466, 105},
+    {0, 4},
+    {233, 93},
+    {0, 45},
+    {466, 115},
+    {0, 14},
+    {1108, 72},
+    {0, 29},
+    {233, 113},
+    {0, 135},
+    {739, 63},
+    {0, 43},
+    {587, 94},
+    {0, 27},
+    {587, 224},
+    {0, 57},
+    {987, 116},
+    {0, 118},
+    {1174, 81},
+    {0, 39},
+    {987, 65},
+    {0, 56},
+    {164, 461},
+    {0, 42},
+    {391, 132},
+    {0, 130},
+    {987, 111},
+    {0, 10},
+    {783, 64},
+    {0, 64},
+    {164, 255},
+    {0, 8},
+    {493, 107},
+    {0, 6},
+    {391, 93},
+    {0, 24},
+    {329, 155},
+    {0, 90},
+    {783, 118},
+    {659, 73},
+    {0, 70},
+    {164, 237},
+    {0, 2},
+    {329, 99},
+    {0, 4},
+    {659, 64},
+    {0, 58},
+    {523, 120},
+    {0, 119},
+    {523, 126},
+    {0, 123},
+    {493, 236},
+    {466, 158},
+    {0, 122},
+    {391, 228},
+    {0, 27},
+    {277, 121},
+    {0, 111},
+    {493, 187},
+    {0, 49},
+    {466, 99},
+    {0, 25},
+    {554, 84},
+    {0, 43},
+    {554, 157},
+    {0, 92},
+    {587, 89},
+    {0, 20},
+    {554, 83},
+    {0, 45},
+    {493, 226},
+    {0, 30},
+    {493, 108},
+    {0, 6},
+    {246, 81},
+    {0, 45},
+    {739, 125},
+    {0, 6},
+    {493, 87},
+    {0, 37},
+    {587, 96},
+    {0, 12},
+    {739, 86},
+    {0, 46},
+    {987, 101},
+    {0, 139},
+    {123, 108},
+    {0, 125},
+    {184, 128},
+    {587, 116},
+    {0, 22},
+    {554, 90},
+    {0, 20},
+    {587, 73},
+    {0, 68},
+    {554, 256},
+    {0, 241},
+    {440, 156},
+    {0, 108},
+    {880, 85},
+    {0, 39},
+    {739, 54},
+    {0, 41},
+    {369, 170},
+    {0, 81},
+    {92, 105},
+    {0, 37},
+    {554, 85},
+    {0, 20},
+    {440, 181},
+    {0, 72},
+    {110, 109},
+    {0, 6},
+    {440, 102},
+    {0, 29},
+    {220, 174},
+    {0, 77},
+    {220, 94},
+    {184, 91},
+    {0, 56},
+    {369, 186},
+    {0, 60},
+    {493, 159},
+    {0, 86},
+    {123, 218},
+    {0, 32},
+    {123, 207},
+    {0, 41},
+    {123, 181},
+    {0, 47},
+    {123, 163},
+    {0, 93},
+    {164, 167},
+    {0, 74},
+    {246, 106},
+    {0, 6},
+    {195, 89},
+    {0, 45},
+    {164, 187},
+    {0, 63},
+    {195, 111},
+    {0, 22},
+    {783, 70},
+    {0, 54},
+    {138, 155},
+    {0, 109},
+    {110, 143},
+    {0, 88},
+    {659, 183},
+    {0, 67},
+    {138, 126},
+    {0, 132},
+    {329, 196},
+    {0, 43},
+    {164, 170},
+    {0, 81},
+    {184, 150},
+    {0, 91},
+    {739, 62},
+    {0, 58},
+    {587, 78},
+    {0, 47},
+    {493, 113},
+    {0, 18},
+    {587, 78},
+    {0, 27},
+    {391, 128},
+    {0, 4},
+    {587, 107},
+    {0, 14},
+    {220, 131},
+    {0, 120},
+    {440, 133},
+    {0, 115},
+    {739, 84},
+    {0, 29},
+    {659, 90},
+    {0, 33},
+    {440, 125},
+    {0, 6},
+    {659, 78},
+    {0, 43},
+    {587, 93},
+    {0, 22},
+    {739, 64},
+    {0, 51},
+    {587, 150},
+    {0, 110},
+    {587, 69},
+    {0, 54},
+    {783, 127},
+    {0, 4},
+    {195, 126},
+    {0, 118},
+    {369, 177},
+    {0, 59},
+    {220, 126},
+    {0, 2},
+    {554, 132},
+    {391, 193},
+    {0, 38},
+    {246, 134},
+    {0, 6},
+    {554, 128},
+    {0, 2},
+    {587, 72},
+    {0, 52},
+    {987, 83},
+    {0, 14},
+    {164, 130},
+    {0, 26},
+    {783, 66},
+    {0, 31},
+    {369, 143},
+    {0, 101},
+    {493, 139},
+    {0, 104},
+    {440, 123},
+    {0, 131},
+    {391, 128},
+    {0, 43},
+    {659, 79},
+    {0, 2},
+    {146, 138},
+    {0, 122},
+    {110, 110},
+    {0, 120},
+    {73, 137},
+    {0, 113},
+    {739, 316},
+    {0, 49},
+    {659, 80},
+    {0, 50},
+    {440, 119},
+    {0, 119},
+    {146, 164},
+    {0, 79},
+    {739, 195},
+    {0, 58},
+    {659, 74},
+    {0, 12},
+    {739, 65},
+    {587, 101},
+    {0, 4},
+    {659, 143},
+    {0, 95},
+    {116, 119},
+    {0, 132},
+    {659, 316},
+    {0, 41},
+    {587, 90},
+    {0, 37},
+    {466, 105},
+    {0, 4},
+    {233, 93},
+    {0, 45},
+    {466, 115},
+    {0, 14},
+    {1108, 72},
+    {0, 29},
+    {233, 113},
+    {0, 135},
+    {739, 63},
+    {0, 43},
+    {587, 94},
+    {0, 27},
+    {587, 224},
+    {0, 57},
+    {987, 116},
+    {0, 118},
+    {1174, 81},
+    {0, 39},
+    {987, 65},
+    {0, 56},
+    {164, 461},
+    {0, 42},
+    {391, 132},
+    {0, 130},
+    {987, 111},
+    {0, 10},
+    {783, 64},
+    {0, 64},
+    {164, 255},
+    {0, 8},
+    {493, 107},
+    {0, 6},
+    {391, 93},
+    {0, 24},
+    {329, 155},
+    {0, 90},
+    {783, 118},
+    {659, 73},
+    {0, 70},
+    {164, 237},
+    {0, 2},
+    {329, 99},
+    {0, 4},
+    {659, 64},
+    {0, 58},
+    {523, 120},
+    {0, 119},
+    {523, 126},
+    {0, 123},
+    {493, 236},
+    {466, 158},
+    {0, 122},
+    {391, 228},
+    {0, 27},
+    {277, 121},
+    {0, 111},
+    {493, 187},
+    {0, 49},
+    {466, 99},
+    {0, 25},
+    {554, 84},
+    {0, 43},
+    {554, 157},
+    {0, 92},
+    {587, 89},
+    {0, 20},
+    {554, 83},
+    {0, 45},
+    {493, 226},
+    {0, 30},
+    {493, 108},
+    {0, 6},
+    {246, 81},
+    {0, 45},
+    {739, 125},
+    {0, 6},
+    {493, 87},
+    {0, 37},
+    {587, 96},
+    {0, 12},
+    {739, 86},
+    {0, 46},
+    {987, 101},
+    {0, 139},
+    {123, 108},
+    {0, 125},
+    {184, 129},
+    {587, 125},
+    {0, 27},
+    {554, 113},
+    {0, 25},
+    {587, 91},
+    {0, 85},
+    {554, 320},
+};
+
+const uint16_t song_length = sizeof (song) / sizeof (song[0]);
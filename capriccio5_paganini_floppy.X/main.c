@@ -1,2383 +0,0 @@
-#include <xc.h>
-#include <stdio.h>
-#include <stdint.h>
-#include <math.h>
-#include <stdlib.h>
-
-#define _XTAL_FREQ 64000000
-
-#pragma config FOSC = INTIO67   // Oscillator Selection bits (Internal oscillator block)
-#pragma config PLLCFG = 0     // 4X PLL Enable (Oscillator used directly)
-#pragma config PRICLKEN = 1    // Primary clock enable bit (Primary clock enabled)
-#pragma config FCMEN = 0      // Fail-Safe Clock Monitor Enable bit (Fail-Safe Clock Monitor disabled)
-#pragma config IESO = 0       // Internal/External Oscillator Switchover bit (Oscillator Switchover mode disabled)
-
-// CONFIG2L
-#pragma config PWRTEN = 0     // Power-up Timer Enable bit (Power up timer disabled)
-#pragma config BOREN = SBORDIS  // Brown-out Reset Enable bits (Brown-out Reset enabled in hardware only (SBOREN is disabled))
-#pragma config BORV = 190       // Brown Out Reset Voltage bits (VBOR set to 1.90 V nominal)
-
-// CONFIG2H
-#pragma config WDTEN = 0       // Watchdog Timer Enable bits (WDT is always enabled. SWDTEN bit has no effect)
-#pragma config WDTPS = 32768    // Watchdog Timer Postscale Select bits (1:32768)
-
-void OSCILLATOR_Initialize(void);
-void TIMER1_Initialize(void);
-void UART_Initialize(void);
-void putch(char c);
-char read_char(void);
-void read_line(char * s, int max_len);
-void Beep(uint16_t frequency, uint16_t duration);
-void sleep(uint16_t ms);
-void paganini(void);
-void __interrupt() ISR(void);
-
-uint16_t offset;
-uint8_t cnt = 0, on = 0;
-
-void main(void) {
-    int f, ms = 100;
-    char str[20];
-    OSCILLATOR_Initialize();
-    UART_Initialize();
-    printf("\n\rRESET\n\r"); //debug
-    TIMER1_Initialize(); //tone generator timer
-    INTCONbits.GIE = 1; // global enable interrupts
-    INTCONbits.PEIE = 1; // peripheral enable interrupts
-    ANSELAbits.ANSA0 = 0; //set RA0 as digital
-    ANSELAbits.ANSA1 = 0; //set RA1 as digital
-    TRISAbits.RA0 = 0; //RA0 as output
-    TRISAbits.RA1 = 0; //RA1 as output
-    LATAbits.LA1 = 0; //floppy dyrection
-    LATAbits.LA0 = 0; //floppy square wave
-    Beep(698, 2714); //put head in 0 position
-    on = 1;
-    cnt = 0;
-    LATAbits.LA1 = ~LATAbits.LA1;
-    sleep(1714);
-    printf("Paganini - Capriccio n.5.\n\r");
-    paganini();
-    while (1) {
-        printf("Digitare una frequenza intera: ");
-        read_line(str, 20);
-        if (str[0] != 0) f = atoi(str);
-        Beep(f, ms);
-    }
-    return;
-}
-
-void OSCILLATOR_Initialize(void) {
-    // setup oscillator
-    OSCCONbits.SCS = 0b00; // primary clock determined by CONFIG1H
-    OSCCONbits.IRCF = 0b111; // 16 MHz internal oscillator
-    OSCTUNEbits.PLLEN = 1; // Enable PLL
-    while (OSCCONbits.HFIOFS == 0); // busy-wait until high frequency
-    // oscillator becomes stable
-    // now, using 16MHz + 4xPLL, we have an FOSC of 64 MHz
-}
-
-void TIMER1_Initialize(void) { //tone generator timer
-    T1CONbits.TMR1ON = 0; //stop the timer
-    T1CONbits.TMR1CS = 0; //Timer1 clock source is instruction clock (FOSC/4)
-    T1CONbits.T1RD16 = 1; //Enables register read/write of Timer1 in one 16-bit operation
-    T1CONbits.T1CKPS = 3; //1:8 Prescale value
-    TMR1 = 0x0000;
-    PIR1bits.TMR1IF = 0;
-    PIE1bits.TMR1IE = 1;
-}
-
-void UART_Initialize(void) {
-    ANSELA = 0;
-    ANSELC = 0;
-    // setup UART
-    TRISCbits.TRISC6 = 0; // TX
-    TRISCbits.TRISC7 = 1; // RX
-
-    TXSTA1bits.SYNC = 0;
-    TXSTA1bits.TX9 = 0;
-    TXSTA1bits.TXEN = 1;
-
-    RCSTA1bits.RX9 = 0;
-    RCSTA1bits.CREN = 1;
-    RCSTA1bits.SPEN = 1;
-
-    BAUDCON1bits.BRG16 = 0;
-    TXSTA1bits.BRGH = 0;
-    //SPBRG1 = 8; // 115200
-    SPBRG1 = 51; // 19200
-    SPBRGH1 = 0;
-}
-
-void putch(char c) {
-    // wait the end of transmission
-    while (TXSTA1bits.TRMT == 0) {
-    };
-    TXREG1 = c; // send the new byte
-}
-
-char read_char(void) {
-    while (PIR1bits.RC1IF == 0) {
-        if (RCSTA1bits.OERR == 1) {
-            RCSTA1bits.OERR = 0;
-            RCSTA1bits.CREN = 0;
-            RCSTA1bits.CREN = 1;
-        }
-    }
-    return RCREG1;
-}
-
-void read_line(char * s, int max_len) {
-    int i = 0;
-    for (;;) {
-        char c = read_char();
-        if (c == 13) {
-            putchar(c);
-            putchar(10);
-            s[i] = 0;
-            return;
-        } else if (c == 127 || c == 8) {
-            if (i > 0) {
-                putchar(c);
-                putchar(' ');
-                putchar(c);
-                --i;
-            }
-        } else if (c >= 32) {
-            if (i < max_len) {
-                putchar(c);
-                s[i] = c;
-                ++i;
-            }
-        }
-    }
-}
-
-void Beep(uint16_t frequency, uint16_t duration) {
-    int i;
-    frequency = (uint16_t)((double)frequency / 16);
-    offset = (uint16_t) ((double) 65535 - ((double) 1000000 / (double) frequency)); //load start timer value
-    TMR1 = offset;
-    T1CONbits.TMR1ON = 1; //start tone generator timer
-    for (i = 0; i < duration; i++) {
-        __delay_ms(1);
-    }
-    T1CONbits.TMR1ON = 0; //stop tone generator timer
-}
-
-void sleep(uint16_t ms) {
-    int i;
-    for (i = 0; i < ms; i++) {
-        __delay_ms(1);
-    }
-}
-
-void __interrupt() ISR(void) {
-    if (PIR1bits.TMR1IF) { //tone generator timer
-        TMR1 = offset;
-        cnt++;
-        LATAbits.LA0 = ~LATAbits.LA0;
-        PIR1bits.TMR1IF = 0;
-    }
-    if (cnt == 140 && on == 1) { //inversion counter
-        cnt = 0;
-        LATAbits.LA1 = ~LATAbits.LA1;
-    }
-}
-
-void paganini() {
-        Beep(698, 136);
-        sleep(5);
-        Beep(698, 1714);
-        Beep(830, 71);
-        Beep(1046, 71);
-        Beep(1396, 71);
-        Beep(1661, 71);
-        Beep(2093, 71);
-        Beep(2793, 71);
-        Beep(3322, 71);
-        Beep(4186, 71);
-        Beep(5587, 761);
-        sleep(95);
-        Beep(4978, 71);
-        Beep(4434, 71);
-        Beep(4186, 71);
-        Beep(3729, 71);
-        Beep(3322, 71);
-        Beep(3135, 71);
-        Beep(2793, 71);
-        Beep(2637, 71);
-        Beep(2217, 71);
-        Beep(2093, 71);
-        Beep(1864, 71);
-        Beep(1661, 71);
-        Beep(1567, 71);
-        Beep(1396, 71);
-        Beep(1318, 71);
-        Beep(1108, 71);
-        Beep(1046, 71);
-        Beep(932, 71);
-        Beep(830, 71);
-        Beep(783, 71);
-        Beep(698, 761);
-        sleep(95);
-        Beep(830, 71);
-        Beep(1046, 71);
-        Beep(1396, 71);
-        Beep(1661, 71);
-        Beep(2093, 71);
-        Beep(2793, 71);
-        Beep(3322, 71);
-        Beep(4186, 71);
-        Beep(5587, 71);
-        Beep(6644, 761);
-        sleep(95);
-        Beep(6271, 71);
-        Beep(5587, 71);
-        Beep(5274, 71);
-        Beep(4434, 71);
-        Beep(4186, 71);
-        Beep(3729, 71);
-        Beep(3322, 71);
-        Beep(3135, 71);
-        Beep(2793, 71);
-        Beep(2637, 71);
-        Beep(2217, 71);
-        Beep(2093, 71);
-        Beep(1864, 71);
-        Beep(1661, 71);
-        Beep(1567, 71);
-        Beep(1396, 71);
-        Beep(1318, 71);
-        Beep(1108, 71);
-        Beep(1046, 71);
-        Beep(932, 71);
-        Beep(830, 71);
-        Beep(783, 71);
-        Beep(698, 761);
-        sleep(95);
-        Beep(830, 71);
-        Beep(1046, 71);
-        Beep(1396, 71);
-        Beep(1661, 71);
-        Beep(2093, 71);
-        Beep(2793, 71);
-        Beep(3322, 71);
-        Beep(4186, 71);
-        Beep(5587, 71);
-        Beep(6644, 71);
-        Beep(8372, 761);
-        sleep(95);
-        Beep(7458, 71);
-        Beep(6644, 71);
-        Beep(6271, 71);
-        Beep(5587, 71);
-        Beep(5274, 71);
-        Beep(4434, 71);
-        Beep(4186, 71);
-        Beep(3729, 71);
-        Beep(3322, 71);
-        Beep(3135, 71);
-        Beep(2793, 71);
-        Beep(2637, 71);
-        Beep(2217, 71);
-        Beep(2093, 71);
-        Beep(1864, 71);
-        Beep(1661, 71);
-        Beep(1567, 71);
-        Beep(1396, 71);
-        Beep(1318, 71);
-        Beep(1108, 71);
-        Beep(1046, 71);
-        Beep(932, 71);
-        Beep(830, 71);
-        Beep(783, 71);
-        Beep(698, 761);
-        sleep(95);
-        Beep(830, 71);
-        Beep(1046, 71);
-        Beep(1396, 71);
-        Beep(1661, 71);
-        Beep(2093, 71);
-        Beep(2793, 71);
-        Beep(3322, 71);
-        Beep(4186, 71);
-        Beep(5587, 71);
-        Beep(6644, 71);
-        Beep(8372, 71);
-        Beep(11175, 761);
-        sleep(95);
-        Beep(9956, 71);
-        Beep(8869, 71);
-        Beep(8372, 71);
-        Beep(7458, 71);
-        Beep(6644, 71);
-        Beep(6271, 71);
-        Beep(5587, 71);
-        Beep(5274, 71);
-        Beep(4434, 71);
-        Beep(4186, 71);
-        Beep(3729, 71);
-        Beep(3322, 71);
-        Beep(3135, 71);
-        Beep(2793, 71);
-        Beep(2637, 71);
-        Beep(2217, 71);
-        Beep(2093, 71);
-        Beep(1864, 71);
-        Beep(1661, 71);
-        Beep(1567, 71);
-        Beep(1396, 71);
-        Beep(1318, 71);
-        Beep(1108, 71);
-        Beep(1046, 71);
-        Beep(932, 71);
-        Beep(830, 71);
-        Beep(783, 65);
-        sleep(5);
-        Beep(698, 450);
-        Beep(739, 75);
-        Beep(783, 75);
-        Beep(830, 75);
-        Beep(880, 75);
-        Beep(932, 75);
-        Beep(987, 75);
-        Beep(1046, 75);
-        Beep(1108, 75);
-        Beep(1174, 68);
-        Beep(1244, 68);
-        Beep(1318, 68);
-        Beep(1396, 68);
-        Beep(1479, 68);
-        Beep(1567, 68);
-        Beep(1661, 68);
-        Beep(1760, 68);
-        Beep(1864, 62);
-        Beep(1975, 62);
-        Beep(2093, 62);
-        Beep(2217, 62);
-        Beep(2349, 62);
-        Beep(2489, 62);
-        Beep(2637, 62);
-        Beep(2793, 62);
-        Beep(2637, 62);
-        Beep(2489, 62);
-        Beep(2349, 62);
-        Beep(2217, 62);
-        Beep(2093, 68);
-        Beep(1975, 68);
-        Beep(1864, 68);
-        Beep(1760, 68);
-        Beep(1661, 71);
-        Beep(1567, 71);
-        Beep(1479, 71);
-        Beep(1396, 71);
-        Beep(1318, 71);
-        Beep(1244, 71);
-        Beep(1174, 71);
-        Beep(1108, 71);
-        Beep(1046, 75);
-        Beep(987, 75);
-        Beep(932, 75);
-        Beep(880, 75);
-        Beep(830, 83);
-        Beep(783, 83);
-        Beep(739, 76);
-        sleep(6);
-        Beep(698, 999);
-        Beep(830, 130);
-        sleep(5);
-        Beep(1661, 454);
-        sleep(636);
-        Beep(698, 63);
-        sleep(26);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1046, 59);
-        sleep(29);
-        Beep(830, 59);
-        sleep(29);
-        Beep(783, 63);
-        sleep(26);
-        Beep(932, 63);
-        sleep(26);
-        Beep(1046, 59);
-        sleep(29);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(932, 63);
-        sleep(26);
-        Beep(830, 63);
-        sleep(26);
-        Beep(783, 59);
-        sleep(29);
-        Beep(698, 63);
-        sleep(26);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1046, 59);
-        sleep(29);
-        Beep(830, 59);
-        sleep(29);
-        Beep(783, 63);
-        sleep(26);
-        Beep(932, 63);
-        sleep(26);
-        Beep(1046, 59);
-        sleep(29);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(932, 63);
-        sleep(26);
-        Beep(830, 63);
-        sleep(26);
-        Beep(783, 59);
-        sleep(29);
-        Beep(698, 63);
-        sleep(26);
-        Beep(880, 63);
-        sleep(26);
-        Beep(1046, 59);
-        sleep(29);
-        Beep(880, 59);
-        sleep(29);
-        Beep(698, 63);
-        sleep(26);
-        Beep(932, 63);
-        sleep(26);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(932, 59);
-        sleep(29);
-        Beep(622, 63);
-        sleep(26);
-        Beep(783, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(783, 59);
-        sleep(29);
-        Beep(622, 63);
-        sleep(26);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(830, 59);
-        sleep(29);
-        Beep(659, 63);
-        sleep(26);
-        Beep(783, 63);
-        sleep(26);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(698, 63);
-        sleep(26);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(987, 59);
-        sleep(29);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(2637, 63);
-        sleep(26);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(3729, 63);
-        sleep(26);
-        Beep(4186, 59);
-        sleep(29);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(2217, 59);
-        sleep(29);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1567, 59);
-        sleep(29);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(2217, 59);
-        sleep(29);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1567, 59);
-        sleep(29);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1760, 59);
-        sleep(29);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(2217, 59);
-        sleep(29);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(2793, 59);
-        sleep(29);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1046, 59);
-        sleep(29);
-        Beep(932, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(830, 59);
-        sleep(29);
-        Beep(783, 63);
-        sleep(26);
-        Beep(932, 63);
-        sleep(26);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(783, 59);
-        sleep(29);
-        Beep(698, 63);
-        sleep(26);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(698, 59);
-        sleep(29);
-        Beep(659, 63);
-        sleep(26);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(659, 59);
-        sleep(29);
-        Beep(622, 63);
-        sleep(26);
-        Beep(783, 63);
-        sleep(26);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(783, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(932, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(2217, 59);
-        sleep(29);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1567, 59);
-        sleep(29);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(3135, 59);
-        sleep(29);
-        Beep(2793, 59);
-        sleep(29);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(2489, 59);
-        sleep(29);
-        Beep(2349, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(1567, 59);
-        sleep(29);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(2489, 59);
-        sleep(29);
-        Beep(2217, 59);
-        sleep(29);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1760, 59);
-        sleep(29);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1975, 59);
-        sleep(29);
-        Beep(2349, 63);
-        sleep(26);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(2349, 59);
-        sleep(29);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(830, 59);
-        sleep(29);
-        Beep(622, 59);
-        sleep(29);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1567, 59);
-        sleep(29);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(932, 63);
-        sleep(26);
-        Beep(783, 63);
-        sleep(26);
-        Beep(622, 59);
-        sleep(29);
-        Beep(698, 63);
-        sleep(26);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(2959, 59);
-        sleep(29);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(2637, 63);
-        sleep(26);
-        Beep(2489, 59);
-        sleep(29);
-        Beep(2349, 59);
-        sleep(29);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(1174, 59);
-        sleep(29);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(987, 59);
-        sleep(29);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(783, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(622, 59);
-        sleep(29);
-        Beep(830, 59);
-        sleep(29);
-        Beep(783, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(622, 63);
-        sleep(26);
-        Beep(830, 59);
-        sleep(29);
-        Beep(783, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1046, 59);
-        sleep(29);
-        Beep(830, 59);
-        sleep(29);
-        Beep(739, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1046, 59);
-        sleep(29);
-        Beep(739, 59);
-        sleep(29);
-        Beep(698, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(830, 63);
-        sleep(26);
-        Beep(698, 59);
-        sleep(29);
-        Beep(622, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(739, 63);
-        sleep(26);
-        Beep(622, 59);
-        sleep(29);
-        Beep(698, 63);
-        sleep(26);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1760, 59);
-        sleep(29);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1046, 59);
-        sleep(29);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(987, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(987, 59);
-        sleep(29);
-        Beep(932, 63);
-        sleep(26);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(987, 63);
-        sleep(26);
-        Beep(830, 59);
-        sleep(29);
-        Beep(932, 63);
-        sleep(26);
-        Beep(2959, 63);
-        sleep(26);
-        Beep(2217, 59);
-        sleep(29);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(2349, 59);
-        sleep(29);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(2349, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(3951, 63);
-        sleep(26);
-        Beep(2959, 59);
-        sleep(29);
-        Beep(2489, 59);
-        sleep(29);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(3729, 63);
-        sleep(26);
-        Beep(3135, 59);
-        sleep(29);
-        Beep(2217, 59);
-        sleep(29);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(1975, 59);
-        sleep(29);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(3135, 59);
-        sleep(29);
-        Beep(2959, 59);
-        sleep(29);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(2637, 63);
-        sleep(26);
-        Beep(2489, 59);
-        sleep(29);
-        Beep(2349, 59);
-        sleep(29);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(1174, 59);
-        sleep(29);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(987, 59);
-        sleep(29);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(987, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(783, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(2637, 63);
-        sleep(26);
-        Beep(2489, 59);
-        sleep(29);
-        Beep(2349, 59);
-        sleep(29);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1975, 59);
-        sleep(29);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1174, 59);
-        sleep(29);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(987, 59);
-        sleep(29);
-        Beep(932, 59);
-        sleep(29);
-        Beep(880, 63);
-        sleep(26);
-        Beep(830, 63);
-        sleep(26);
-        Beep(783, 59);
-        sleep(29);
-        Beep(739, 59);
-        sleep(29);
-        Beep(659, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(987, 63);
-        sleep(26);
-        Beep(830, 59);
-        sleep(29);
-        Beep(622, 63);
-        sleep(26);
-        Beep(987, 63);
-        sleep(26);
-        Beep(880, 63);
-        sleep(26);
-        Beep(739, 59);
-        sleep(29);
-        Beep(659, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(987, 59);
-        sleep(29);
-        Beep(830, 59);
-        sleep(29);
-        Beep(783, 63);
-        sleep(26);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(987, 59);
-        sleep(29);
-        Beep(830, 59);
-        sleep(29);
-        Beep(739, 63);
-        sleep(26);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(880, 59);
-        sleep(29);
-        Beep(783, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(987, 59);
-        sleep(29);
-        Beep(880, 63);
-        sleep(26);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(880, 59);
-        sleep(29);
-        Beep(739, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(2959, 59);
-        sleep(29);
-        Beep(2637, 63);
-        sleep(26);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(987, 63);
-        sleep(26);
-        Beep(880, 63);
-        sleep(26);
-        Beep(830, 63);
-        sleep(26);
-        Beep(739, 59);
-        sleep(29);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(987, 59);
-        sleep(29);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(2489, 59);
-        sleep(29);
-        Beep(1975, 59);
-        sleep(29);
-        Beep(2637, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(987, 59);
-        sleep(29);
-        Beep(880, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(987, 63);
-        sleep(26);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(1174, 59);
-        sleep(29);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(987, 59);
-        sleep(29);
-        Beep(880, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(880, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1567, 59);
-        sleep(29);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(932, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(987, 63);
-        sleep(26);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(1174, 59);
-        sleep(29);
-        Beep(987, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1108, 59);
-        sleep(29);
-        Beep(987, 63);
-        sleep(26);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(987, 63);
-        sleep(26);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(1760, 59);
-        sleep(29);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1174, 59);
-        sleep(29);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(1760, 59);
-        sleep(29);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(2349, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1760, 59);
-        sleep(29);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(880, 59);
-        sleep(29);
-        Beep(739, 59);
-        sleep(29);
-        Beep(783, 63);
-        sleep(26);
-        Beep(987, 63);
-        sleep(26);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(1567, 59);
-        sleep(29);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(2349, 63);
-        sleep(26);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(3951, 59);
-        sleep(29);
-        Beep(987, 63);
-        sleep(26);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(987, 63);
-        sleep(26);
-        Beep(880, 63);
-        sleep(26);
-        Beep(739, 59);
-        sleep(29);
-        Beep(622, 59);
-        sleep(29);
-        Beep(659, 63);
-        sleep(26);
-        Beep(783, 63);
-        sleep(26);
-        Beep(987, 63);
-        sleep(26);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(2637, 63);
-        sleep(26);
-        Beep(3135, 59);
-        sleep(29);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1567, 59);
-        sleep(29);
-        Beep(1318, 59);
-        sleep(29);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1567, 59);
-        sleep(29);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1567, 59);
-        sleep(29);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(2349, 59);
-        sleep(29);
-        Beep(1760, 59);
-        sleep(29);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(2349, 59);
-        sleep(29);
-        Beep(1975, 59);
-        sleep(29);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(2637, 63);
-        sleep(26);
-        Beep(1975, 59);
-        sleep(29);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(2959, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(2349, 63);
-        sleep(26);
-        Beep(3135, 59);
-        sleep(29);
-        Beep(2349, 59);
-        sleep(29);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(2637, 63);
-        sleep(26);
-        Beep(3135, 59);
-        sleep(29);
-        Beep(2637, 59);
-        sleep(29);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(2959, 63);
-        sleep(26);
-        Beep(2489, 59);
-        sleep(29);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(2349, 63);
-        sleep(26);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(2349, 59);
-        sleep(29);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(2637, 59);
-        sleep(29);
-        Beep(2217, 59);
-        sleep(29);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(2793, 59);
-        sleep(29);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(2349, 63);
-        sleep(26);
-        Beep(1975, 59);
-        sleep(29);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1760, 59);
-        sleep(29);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(2217, 59);
-        sleep(29);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1567, 63);
-        sleep(26);
-        Beep(2093, 63);
-        sleep(26);
-        Beep(1567, 59);
-        sleep(29);
-        Beep(1244, 63);
-        sleep(26);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(1760, 59);
-        sleep(29);
-        Beep(1479, 59);
-        sleep(29);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1864, 59);
-        sleep(29);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(1396, 59);
-        sleep(29);
-        Beep(1046, 68);
-        sleep(28);
-        Beep(1318, 68);
-        sleep(28);
-        Beep(1567, 64);
-        sleep(32);
-        Beep(2093, 64);
-        sleep(32);
-        Beep(2637, 68);
-        sleep(28);
-        Beep(3135, 68);
-        sleep(28);
-        Beep(4186, 64);
-        sleep(32);
-        Beep(5274, 64);
-        sleep(32);
-        Beep(2217, 66);
-        sleep(27);
-        Beep(2793, 66);
-        sleep(27);
-        Beep(3729, 66);
-        sleep(27);
-        Beep(2793, 62);
-        sleep(31);
-        Beep(2217, 66);
-        sleep(27);
-        Beep(2793, 66);
-        sleep(27);
-        Beep(3951, 66);
-        sleep(27);
-        Beep(2793, 62);
-        sleep(31);
-        Beep(2093, 68);
-        sleep(28);
-        Beep(2637, 68);
-        sleep(28);
-        Beep(3135, 64);
-        sleep(32);
-        Beep(4186, 64);
-        sleep(32);
-        Beep(5274, 70);
-        sleep(29);
-        Beep(6271, 70);
-        sleep(29);
-        Beep(8372, 66);
-        sleep(33);
-        Beep(10548, 66);
-        sleep(33);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(4186, 63);
-        sleep(26);
-        Beep(3322, 59);
-        sleep(29);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(3729, 63);
-        sleep(26);
-        Beep(4186, 63);
-        sleep(26);
-        Beep(3729, 59);
-        sleep(29);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(5587, 63);
-        sleep(26);
-        Beep(4978, 59);
-        sleep(29);
-        Beep(4434, 59);
-        sleep(29);
-        Beep(4186, 63);
-        sleep(26);
-        Beep(3729, 63);
-        sleep(26);
-        Beep(3322, 59);
-        sleep(29);
-        Beep(3135, 59);
-        sleep(29);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(4186, 63);
-        sleep(26);
-        Beep(3322, 59);
-        sleep(29);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(3729, 63);
-        sleep(26);
-        Beep(4186, 63);
-        sleep(26);
-        Beep(3729, 59);
-        sleep(29);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(5587, 63);
-        sleep(26);
-        Beep(4978, 59);
-        sleep(29);
-        Beep(4434, 59);
-        sleep(29);
-        Beep(4186, 63);
-        sleep(26);
-        Beep(3729, 63);
-        sleep(26);
-        Beep(3520, 59);
-        sleep(29);
-        Beep(2793, 59);
-        sleep(29);
-        Beep(3729, 63);
-        sleep(26);
-        Beep(4978, 63);
-        sleep(26);
-        Beep(4434, 63);
-        sleep(26);
-        Beep(4186, 59);
-        sleep(29);
-        Beep(3729, 63);
-        sleep(26);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(2489, 59);
-        sleep(29);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(4434, 63);
-        sleep(26);
-        Beep(4186, 59);
-        sleep(29);
-        Beep(3729, 59);
-        sleep(29);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(2793, 59);
-        sleep(29);
-        Beep(2217, 59);
-        sleep(29);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(4186, 63);
-        sleep(26);
-        Beep(3729, 63);
-        sleep(26);
-        Beep(3322, 59);
-        sleep(29);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(2637, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(3729, 63);
-        sleep(26);
-        Beep(3322, 59);
-        sleep(29);
-        Beep(3135, 59);
-        sleep(29);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(2489, 63);
-        sleep(26);
-        Beep(2217, 59);
-        sleep(29);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(2349, 59);
-        sleep(29);
-        Beep(1975, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(987, 59);
-        sleep(29);
-        Beep(3322, 63);
-        sleep(26);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1661, 59);
-        sleep(29);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(830, 59);
-        sleep(29);
-        Beep(698, 59);
-        sleep(29);
-        Beep(3135, 63);
-        sleep(26);
-        Beep(2637, 63);
-        sleep(26);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1567, 59);
-        sleep(29);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(932, 63);
-        sleep(26);
-        Beep(783, 63);
-        sleep(26);
-        Beep(659, 59);
-        sleep(29);
-        Beep(698, 63);
-        sleep(26);
-        Beep(2793, 63);
-        sleep(26);
-        Beep(2637, 59);
-        sleep(29);
-        Beep(2489, 59);
-        sleep(29);
-        Beep(2349, 63);
-        sleep(26);
-        Beep(2217, 63);
-        sleep(26);
-        Beep(2093, 59);
-        sleep(29);
-        Beep(1975, 59);
-        sleep(29);
-        Beep(1864, 63);
-        sleep(26);
-        Beep(1760, 63);
-        sleep(26);
-        Beep(1661, 63);
-        sleep(26);
-        Beep(1567, 59);
-        sleep(29);
-        Beep(1479, 63);
-        sleep(26);
-        Beep(1396, 63);
-        sleep(26);
-        Beep(1318, 63);
-        sleep(26);
-        Beep(1244, 59);
-        sleep(29);
-        Beep(1174, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1046, 59);
-        sleep(29);
-        Beep(987, 59);
-        sleep(29);
-        Beep(932, 63);
-        sleep(26);
-        Beep(880, 63);
-        sleep(26);
-        Beep(830, 59);
-        sleep(29);
-        Beep(783, 59);
-        sleep(29);
-        Beep(698, 63);
-        sleep(26);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1108, 63);
-        sleep(26);
-        Beep(1046, 59);
-        sleep(29);
-        Beep(659, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(932, 63);
-        sleep(26);
-        Beep(783, 59);
-        sleep(29);
-        Beep(698, 63);
-        sleep(26);
-        Beep(830, 63);
-        sleep(26);
-        Beep(783, 59);
-        sleep(29);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(659, 59);
-        sleep(29);
-        Beep(783, 59);
-        sleep(29);
-        Beep(698, 63);
-        sleep(26);
-        Beep(830, 63);
-        sleep(26);
-        Beep(783, 63);
-        sleep(26);
-        Beep(932, 59);
-        sleep(29);
-        Beep(830, 63);
-        sleep(26);
-        Beep(1046, 63);
-        sleep(26);
-        Beep(659, 63);
-        sleep(26);
-        Beep(783, 59);
-        sleep(29);
-        Beep(698, 66);
-        sleep(27);
-        Beep(830, 66);
-        sleep(27);
-        Beep(783, 62);
-        sleep(31);
-        Beep(932, 62);
-        sleep(31);
-        Beep(830, 66);
-        sleep(33);
-        Beep(1046, 70);
-        sleep(29);
-        Beep(659, 66);
-        sleep(33);
-        Beep(783, 66);
-        sleep(33);
-        Beep(698, 81);
-        sleep(33);
-        Beep(830, 81);
-        sleep(33);
-        Beep(783, 81);
-        sleep(33);
-        Beep(932, 76);
-        sleep(38);
-        Beep(830, 96);
-        sleep(39);
-        Beep(1046, 96);
-        sleep(39);
-        Beep(659, 96);
-        sleep(39);
-        Beep(783, 90);
-        sleep(45);
-        Beep(698, 1714);
-        Beep(880, 71);
-        Beep(1046, 71);
-        Beep(1396, 71);
-        Beep(1760, 71);
-        Beep(2093, 71);
-        Beep(2793, 71);
-        Beep(3520, 71);
-        Beep(4186, 71);
-        Beep(5587, 761);
-        sleep(95);
-        Beep(5274, 71);
-        Beep(4698, 71);
-        Beep(4186, 71);
-        Beep(3729, 71);
-        Beep(3520, 71);
-        Beep(3135, 71);
-        Beep(2793, 71);
-        Beep(2637, 71);
-        Beep(2349, 71);
-        Beep(2093, 71);
-        Beep(1864, 71);
-        Beep(1760, 71);
-        Beep(1567, 71);
-        Beep(1396, 71);
-        Beep(1318, 71);
-        Beep(1174, 71);
-        Beep(1046, 71);
-        Beep(932, 71);
-        Beep(880, 71);
-        Beep(783, 71);
-        Beep(698, 761);
-        sleep(95);
-        Beep(880, 71);
-        Beep(1046, 71);
-        Beep(1396, 71);
-        Beep(1760, 71);
-        Beep(2093, 71);
-        Beep(2793, 71);
-        Beep(3520, 71);
-        Beep(4186, 71);
-        Beep(5587, 71);
-        Beep(7040, 761);
-        sleep(95);
-        Beep(6271, 71);
-        Beep(5587, 71);
-        Beep(5274, 71);
-        Beep(4698, 71);
-        Beep(4186, 71);
-        Beep(3729, 71);
-        Beep(3520, 71);
-        Beep(3135, 71);
-        Beep(2793, 71);
-        Beep(2637, 71);
-        Beep(2349, 71);
-        Beep(2093, 71);
-        Beep(1864, 71);
-        Beep(1760, 71);
-        Beep(1567, 71);
-        Beep(1396, 71);
-        Beep(1318, 71);
-        Beep(1174, 71);
-        Beep(1046, 71);
-        Beep(932, 71);
-        Beep(880, 71);
-        Beep(783, 71);
-        Beep(698, 761);
-        sleep(95);
-        Beep(880, 71);
-        Beep(1046, 71);
-        Beep(1396, 71);
-        Beep(1760, 71);
-        Beep(2093, 71);
-        Beep(2793, 71);
-        Beep(3520, 71);
-        Beep(4186, 71);
-        Beep(5587, 71);
-        Beep(7040, 71);
-        Beep(8372, 761);
-        sleep(95);
-        Beep(7458, 71);
-        Beep(7040, 71);
-        Beep(6271, 71);
-        Beep(5587, 71);
-        Beep(5274, 71);
-        Beep(4698, 71);
-        Beep(4186, 71);
-        Beep(3729, 71);
-        Beep(3520, 71);
-        Beep(3135, 71);
-        Beep(2793, 71);
-        Beep(2637, 71);
-        Beep(2349, 71);
-        Beep(2093, 71);
-        Beep(1864, 71);
-        Beep(1760, 71);
-        Beep(1567, 71);
-        Beep(1396, 71);
-        Beep(1318, 71);
-        Beep(1174, 71);
-        Beep(1046, 71);
-        Beep(932, 71);
-        Beep(880, 71);
-        Beep(783, 71);
-        Beep(698, 761);
-        sleep(95);
-        Beep(880, 71);
-        Beep(1046, 71);
-        Beep(1396, 71);
-        Beep(1760, 71);
-        Beep(2093, 71);
-        Beep(2793, 71);
-        Beep(3520, 71);
-        Beep(4186, 71);
-        Beep(5587, 71);
-        Beep(7040, 71);
-        Beep(8372, 71);
-        Beep(11175, 761);
-        sleep(95);
-        Beep(10548, 71);
-        Beep(9397, 71);
-        Beep(8372, 71);
-        Beep(7458, 71);
-        Beep(7040, 71);
-        Beep(6271, 71);
-        Beep(5587, 71);
-        Beep(5274, 71);
-        Beep(4698, 71);
-        Beep(4186, 71);
-        Beep(3729, 71);
-        Beep(3520, 71);
-        Beep(3135, 71);
-        Beep(2793, 71);
-        Beep(2637, 71);
-        Beep(2349, 71);
-        Beep(2093, 71);
-        Beep(1864, 71);
-        Beep(1760, 71);
-        Beep(1567, 71);
-        Beep(1396, 71);
-        Beep(1318, 71);
-        Beep(1174, 71);
-        Beep(1046, 71);
-        Beep(932, 71);
-        Beep(880, 71);
-        Beep(783, 65);
-        sleep(5);
-        Beep(698, 450);
-        Beep(739, 75);
-        Beep(783, 75);
-        Beep(830, 75);
-        Beep(880, 75);
-        Beep(932, 75);
-        Beep(987, 75);
-        Beep(1046, 75);
-        Beep(1108, 75);
-        Beep(1174, 68);
-        Beep(1244, 68);
-        Beep(1318, 68);
-        Beep(1396, 68);
-        Beep(1479, 68);
-        Beep(1567, 68);
-        Beep(1661, 68);
-        Beep(1760, 68);
-        Beep(1864, 62);
-        Beep(1975, 62);
-        Beep(2093, 62);
-        Beep(2217, 62);
-        Beep(2349, 62);
-        Beep(2489, 62);
-        Beep(2637, 62);
-        Beep(2793, 62);
-        Beep(2637, 62);
-        Beep(2489, 62);
-        Beep(2349, 62);
-        Beep(2217, 62);
-        Beep(2093, 68);
-        Beep(1975, 68);
-        Beep(1864, 68);
-        Beep(1760, 68);
-        Beep(1661, 71);
-        Beep(1567, 71);
-        Beep(1479, 71);
-        Beep(1396, 71);
-        Beep(1318, 71);
-        Beep(1244, 71);
-        Beep(1174, 71);
-        Beep(1108, 71);
-        Beep(1046, 75);
-        Beep(987, 75);
-        Beep(932, 75);
-        Beep(880, 75);
-        Beep(830, 83);
-        Beep(783, 83);
-        Beep(739, 76);
-        sleep(6);
-        Beep(698, 999);
-        Beep(880, 130);
-        sleep(5);
-        Beep(1760, 727);
-}
\ No newline at end of file
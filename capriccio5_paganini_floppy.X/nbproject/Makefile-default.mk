@@ -57,17 +57,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=main.c
+SOURCEFILES_QUOTED_IF_SPACED=song.c ../engine/main.c ../engine/engine.c ../engine/debug.c ../engine/alloc.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/main.p1
-POSSIBLE_DEPFILES=${OBJECTDIR}/main.p1.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/song.p1 ${OBJECTDIR}/_ext/engine/main.p1 ${OBJECTDIR}/_ext/engine/engine.p1 ${OBJECTDIR}/_ext/engine/debug.p1 ${OBJECTDIR}/_ext/engine/alloc.p1
+POSSIBLE_DEPFILES=${OBJECTDIR}/song.p1.d ${OBJECTDIR}/_ext/engine/main.p1.d ${OBJECTDIR}/_ext/engine/engine.p1.d ${OBJECTDIR}/_ext/engine/debug.p1.d ${OBJECTDIR}/_ext/engine/alloc.p1.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/main.p1
+OBJECTFILES=${OBJECTDIR}/song.p1 ${OBJECTDIR}/_ext/engine/main.p1 ${OBJECTDIR}/_ext/engine/engine.p1 ${OBJECTDIR}/_ext/engine/debug.p1 ${OBJECTDIR}/_ext/engine/alloc.p1
 
 # Source Files
-SOURCEFILES=main.c
+SOURCEFILES=song.c ../engine/main.c ../engine/engine.c ../engine/debug.c ../engine/alloc.c
 
 
 CFLAGS=
@@ -93,22 +93,86 @@ MP_PROCESSOR_OPTION=18F26K22
 # ------------------------------------------------------------------------------------
 # Rules for buildStep: compile
 ifeq ($(TYPE_IMAGE), DEBUG_RUN)
-${OBJECTDIR}/main.p1: main.c  nbproject/Makefile-${CND_CONF}.mk
+${OBJECTDIR}/song.p1: song.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/main.p1.d 
-	@${RM} ${OBJECTDIR}/main.p1 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx032 -Wl,--data-init -mno-keep-startup -mno-download -mdefault-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/main.p1 main.c 
-	@-${MV} ${OBJECTDIR}/main.d ${OBJECTDIR}/main.p1.d 
-	@${FIXDEPS} ${OBJECTDIR}/main.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	@${RM} ${OBJECTDIR}/song.p1.d 
+	@${RM} ${OBJECTDIR}/song.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -Wa,-a -I"." -I"../engine" -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx032 -Wl,--data-init -mno-keep-startup -mno-download -mdefault-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/song.p1 song.c 
+	@-${MV} ${OBJECTDIR}/song.d ${OBJECTDIR}/song.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/song.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/_ext/engine/main.p1: ../engine/main.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/engine" 
+	@${RM} ${OBJECTDIR}/_ext/engine/main.p1.d 
+	@${RM} ${OBJECTDIR}/_ext/engine/main.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -Wa,-a -I"." -I"../engine" -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx032 -Wl,--data-init -mno-keep-startup -mno-download -mdefault-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/_ext/engine/main.p1 ../engine/main.c 
+	@-${MV} ${OBJECTDIR}/_ext/engine/main.d ${OBJECTDIR}/_ext/engine/main.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/_ext/engine/main.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/_ext/engine/engine.p1: ../engine/engine.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/engine" 
+	@${RM} ${OBJECTDIR}/_ext/engine/engine.p1.d 
+	@${RM} ${OBJECTDIR}/_ext/engine/engine.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -Wa,-a -I"." -I"../engine" -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx032 -Wl,--data-init -mno-keep-startup -mno-download -mdefault-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/_ext/engine/engine.p1 ../engine/engine.c 
+	@-${MV} ${OBJECTDIR}/_ext/engine/engine.d ${OBJECTDIR}/_ext/engine/engine.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/_ext/engine/engine.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/_ext/engine/debug.p1: ../engine/debug.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/engine" 
+	@${RM} ${OBJECTDIR}/_ext/engine/debug.p1.d 
+	@${RM} ${OBJECTDIR}/_ext/engine/debug.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -Wa,-a -I"." -I"../engine" -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx032 -Wl,--data-init -mno-keep-startup -mno-download -mdefault-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/_ext/engine/debug.p1 ../engine/debug.c 
+	@-${MV} ${OBJECTDIR}/_ext/engine/debug.d ${OBJECTDIR}/_ext/engine/debug.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/_ext/engine/debug.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/_ext/engine/alloc.p1: ../engine/alloc.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/engine" 
+	@${RM} ${OBJECTDIR}/_ext/engine/alloc.p1.d 
+	@${RM} ${OBJECTDIR}/_ext/engine/alloc.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -Wa,-a -I"." -I"../engine" -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx032 -Wl,--data-init -mno-keep-startup -mno-download -mdefault-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/_ext/engine/alloc.p1 ../engine/alloc.c 
+	@-${MV} ${OBJECTDIR}/_ext/engine/alloc.d ${OBJECTDIR}/_ext/engine/alloc.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/_ext/engine/alloc.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
 else
-${OBJECTDIR}/main.p1: main.c  nbproject/Makefile-${CND_CONF}.mk
+${OBJECTDIR}/song.p1: song.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}" 
-	@${RM} ${OBJECTDIR}/main.p1.d 
-	@${RM} ${OBJECTDIR}/main.p1 
-	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx032 -Wl,--data-init -mno-keep-startup -mno-download -mdefault-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/main.p1 main.c 
-	@-${MV} ${OBJECTDIR}/main.d ${OBJECTDIR}/main.p1.d 
-	@${FIXDEPS} ${OBJECTDIR}/main.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	@${RM} ${OBJECTDIR}/song.p1.d 
+	@${RM} ${OBJECTDIR}/song.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -Wa,-a -I"." -I"../engine" -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx032 -Wl,--data-init -mno-keep-startup -mno-download -mdefault-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/song.p1 song.c 
+	@-${MV} ${OBJECTDIR}/song.d ${OBJECTDIR}/song.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/song.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/_ext/engine/main.p1: ../engine/main.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/engine" 
+	@${RM} ${OBJECTDIR}/_ext/engine/main.p1.d 
+	@${RM} ${OBJECTDIR}/_ext/engine/main.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -Wa,-a -I"." -I"../engine" -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx032 -Wl,--data-init -mno-keep-startup -mno-download -mdefault-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/_ext/engine/main.p1 ../engine/main.c 
+	@-${MV} ${OBJECTDIR}/_ext/engine/main.d ${OBJECTDIR}/_ext/engine/main.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/_ext/engine/main.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/_ext/engine/engine.p1: ../engine/engine.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/engine" 
+	@${RM} ${OBJECTDIR}/_ext/engine/engine.p1.d 
+	@${RM} ${OBJECTDIR}/_ext/engine/engine.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -Wa,-a -I"." -I"../engine" -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx032 -Wl,--data-init -mno-keep-startup -mno-download -mdefault-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/_ext/engine/engine.p1 ../engine/engine.c 
+	@-${MV} ${OBJECTDIR}/_ext/engine/engine.d ${OBJECTDIR}/_ext/engine/engine.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/_ext/engine/engine.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/_ext/engine/debug.p1: ../engine/debug.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/engine" 
+	@${RM} ${OBJECTDIR}/_ext/engine/debug.p1.d 
+	@${RM} ${OBJECTDIR}/_ext/engine/debug.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -Wa,-a -I"." -I"../engine" -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx032 -Wl,--data-init -mno-keep-startup -mno-download -mdefault-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/_ext/engine/debug.p1 ../engine/debug.c 
+	@-${MV} ${OBJECTDIR}/_ext/engine/debug.d ${OBJECTDIR}/_ext/engine/debug.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/_ext/engine/debug.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/_ext/engine/alloc.p1: ../engine/alloc.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/engine" 
+	@${RM} ${OBJECTDIR}/_ext/engine/alloc.p1.d 
+	@${RM} ${OBJECTDIR}/_ext/engine/alloc.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -Wa,-a -I"." -I"../engine" -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx032 -Wl,--data-init -mno-keep-startup -mno-download -mdefault-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/_ext/engine/alloc.p1 ../engine/alloc.c 
+	@-${MV} ${OBJECTDIR}/_ext/engine/alloc.d ${OBJECTDIR}/_ext/engine/alloc.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/_ext/engine/alloc.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
 endif
 
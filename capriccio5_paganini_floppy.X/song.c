@@ -0,0 +1,1331 @@
+#include "engine.h"
+
+const note_t song[] = { //{frequency, ms}, 0 Hz is a rest
+    {EV_ARTIC, 252},
+    {698, 141},
+    {EV_ARTIC, 256},
+    {698, 1714},
+    {EV_GLIDE, 568}, //the opening arpeggio, one 3 octave slide
+    {EV_VIBRATO, 25},
+    {EV_ARTIC, 239},
+    {5587, 1424},
+    {EV_ARTIC, 249},
+    {4978, 71},
+    {4434, 71},
+    {4186, 71},
+    {3729, 71},
+    {3322, 71},
+    {3135, 71},
+    {2793, 71},
+    {2637, 71},
+    {2217, 71},
+    {2093, 71},
+    {1864, 71},
+    {1661, 71},
+    {1567, 71},
+    {1396, 71},
+    {1318, 71},
+    {1108, 71},
+    {1046, 71},
+    {932, 71},
+    {830, 71},
+    {783, 71},
+    {EV_ARTIC, 228},
+    {698, 856},
+    {EV_ARTIC, 249},
+    {830, 71},
+    {1046, 71},
+    {1396, 71},
+    {1661, 71},
+    {2093, 71},
+    {2793, 71},
+    {3322, 71},
+    {4186, 71},
+    {5587, 71},
+    {EV_VIBRATO, 25},
+    {EV_ARTIC, 228},
+    {6644, 856},
+    {EV_ARTIC, 249},
+    {6271, 71},
+    {5587, 71},
+    {5274, 71},
+    {4434, 71},
+    {4186, 71},
+    {3729, 71},
+    {3322, 71},
+    {3135, 71},
+    {2793, 71},
+    {2637, 71},
+    {2217, 71},
+    {2093, 71},
+    {1864, 71},
+    {1661, 71},
+    {1567, 71},
+    {1396, 71},
+    {1318, 71},
+    {1108, 71},
+    {1046, 71},
+    {932, 71},
+    {830, 71},
+    {783, 71},
+    {EV_ARTIC, 228},
+    {698, 856},
+    {EV_ARTIC, 249},
+    {830, 71},
+    {1046, 71},
+    {1396, 71},
+    {1661, 71},
+    {2093, 71},
+    {2793, 71},
+    {3322, 71},
+    {4186, 71},
+    {5587, 71},
+    {6644, 71},
+    {EV_VIBRATO, 25},
+    {EV_ARTIC, 228},
+    {8372, 856},
+    {EV_ARTIC, 249},
+    {7458, 71},
+    {6644, 71},
+    {6271, 71},
+    {5587, 71},
+    {5274, 71},
+    {4434, 71},
+    {4186, 71},
+    {3729, 71},
+    {3322, 71},
+    {3135, 71},
+    {2793, 71},
+    {2637, 71},
+    {2217, 71},
+    {2093, 71},
+    {1864, 71},
+    {1661, 71},
+    {1567, 71},
+    {1396, 71},
+    {1318, 71},
+    {1108, 71},
+    {1046, 71},
+    {932, 71},
+    {830, 71},
+    {783, 71},
+    {EV_ARTIC, 228},
+    {698, 856},
+    {EV_ARTIC, 249},
+    {830, 71},
+    {1046, 71},
+    {1396, 71},
+    {1661, 71},
+    {2093, 71},
+    {2793, 71},
+    {3322, 71},
+    {4186, 71},
+    {5587, 71},
+    {6644, 71},
+    {8372, 71},
+    {EV_VIBRATO, 25},
+    {EV_ARTIC, 228},
+    {11175, 856},
+    {EV_ARTIC, 249},
+    {9956, 71},
+    {8869, 71},
+    {8372, 71},
+    {7458, 71},
+    {6644, 71},
+    {6271, 71},
+    {5587, 71},
+    {5274, 71},
+    {4434, 71},
+    {4186, 71},
+    {3729, 71},
+    {3322, 71},
+    {3135, 71},
+    {2793, 71},
+    {2637, 71},
+    {2217, 71},
+    {2093, 71},
+    {1864, 71},
+    {1661, 71},
+    {1567, 71},
+    {1396, 71},
+    {1318, 71},
+    {1108, 71},
+    {1046, 71},
+    {932, 71},
+    {830, 71},
+    {EV_ARTIC, 248},
+    {783, 70},
+    {EV_ARTIC, 255},
+    {698, 450},
+    {739, 75},
+    {783, 75},
+    {830, 75},
+    {880, 75},
+    {932, 75},
+    {987, 75},
+    {1046, 75},
+    {1108, 75},
+    {1174, 68},
+    {1244, 68},
+    {1318, 68},
+    {1396, 68},
+    {1479, 68},
+    {1567, 68},
+    {1661, 68},
+    {1760, 68},
+    {1864, 62},
+    {1975, 62},
+    {2093, 62},
+    {2217, 62},
+    {2349, 62},
+    {2489, 62},
+    {2637, 62},
+    {2793, 62},
+    {2637, 62},
+    {2489, 62},
+    {2349, 62},
+    {2217, 62},
+    {2093, 68},
+    {1975, 68},
+    {1864, 68},
+    {1760, 68},
+    {1661, 71},
+    {1567, 71},
+    {1479, 71},
+    {1396, 71},
+    {1318, 71},
+    {1244, 71},
+    {1174, 71},
+    {1108, 71},
+    {1046, 75},
+    {987, 75},
+    {932, 75},
+    {880, 75},
+    {830, 83},
+    {783, 83},
+    {EV_ARTIC, 246},
+    {739, 82},
+    {EV_ARTIC, 256},
+    {698, 999},
+    {EV_ARTIC, 252},
+    {830, 135},
+    {EV_ARTIC, 107},
+    {1661, 1090},
+    {EV_ARTIC, 178},
+    {698, 89},
+    {830, 89},
+    {1046, 88},
+    {830, 88},
+    {783, 89},
+    {932, 89},
+    {1046, 88},
+    {932, 88},
+    {830, 89},
+    {1396, 89},
+    {1244, 89},
+    {1108, 88},
+    {1046, 89},
+    {932, 89},
+    {830, 89},
+    {783, 88},
+    {698, 89},
+    {830, 89},
+    {1046, 88},
+    {830, 88},
+    {783, 89},
+    {932, 89},
+    {1046, 88},
+    {932, 88},
+    {830, 89},
+    {1396, 89},
+    {1244, 89},
+    {1108, 88},
+    {1046, 89},
+    {932, 89},
+    {830, 89},
+    {783, 88},
+    {698, 89},
+    {880, 89},
+    {1046, 88},
+    {880, 88},
+    {698, 89},
+    {932, 89},
+    {1108, 88},
+    {932, 88},
+    {622, 89},
+    {783, 89},
+    {1108, 89},
+    {783, 88},
+    {622, 89},
+    {830, 89},
+    {1046, 89},
+    {830, 88},
+    {659, 89},
+    {783, 89},
+    {1108, 88},
+    {932, 88},
+    {830, 89},
+    {698, 89},
+    {1396, 88},
+    {987, 88},
+    {1046, 89},
+    {1318, 89},
+    {1567, 89},
+    {2093, 88},
+    {2637, 89},
+    {3135, 89},
+    {3729, 89},
+    {4186, 88},
+    {1396, 89},
+    {1661, 89},
+    {2093, 88},
+    {1661, 88},
+    {1567, 89},
+    {1864, 89},
+    {2093, 88},
+    {1864, 88},
+    {1661, 89},
+    {2793, 89},
+    {2489, 89},
+    {2217, 88},
+    {2093, 89},
+    {1864, 89},
+    {1661, 89},
+    {1567, 88},
+    {1396, 89},
+    {1661, 89},
+    {2093, 88},
+    {1661, 88},
+    {1567, 89},
+    {1864, 89},
+    {2093, 88},
+    {1864, 88},
+    {1661, 89},
+    {2793, 89},
+    {2489, 89},
+    {2217, 88},
+    {2093, 89},
+    {1864, 89},
+    {1661, 89},
+    {1567, 88},
+    {1396, 89},
+    {1760, 89},
+    {2093, 88},
+    {1760, 88},
+    {2793, 89},
+    {2489, 89},
+    {2217, 88},
+    {2093, 88},
+    {1760, 89},
+    {1864, 89},
+    {3135, 89},
+    {2793, 88},
+    {2489, 89},
+    {2217, 89},
+    {2093, 89},
+    {1864, 88},
+    {1661, 89},
+    {1567, 89},
+    {1396, 88},
+    {1244, 88},
+    {1174, 89},
+    {1244, 89},
+    {1396, 88},
+    {1108, 88},
+    {1046, 89},
+    {1244, 89},
+    {1661, 89},
+    {1046, 88},
+    {932, 89},
+    {1108, 89},
+    {1567, 89},
+    {932, 88},
+    {830, 89},
+    {1046, 89},
+    {1396, 88},
+    {830, 88},
+    {783, 89},
+    {932, 89},
+    {1244, 88},
+    {783, 88},
+    {698, 89},
+    {830, 89},
+    {1108, 89},
+    {698, 88},
+    {659, 89},
+    {830, 89},
+    {1108, 89},
+    {659, 88},
+    {622, 89},
+    {783, 89},
+    {1108, 88},
+    {783, 88},
+    {830, 89},
+    {1046, 89},
+    {1244, 88},
+    {1661, 88},
+    {932, 89},
+    {1108, 89},
+    {1567, 89},
+    {1864, 88},
+    {1046, 89},
+    {1244, 89},
+    {1661, 89},
+    {2093, 88},
+    {1108, 89},
+    {1396, 89},
+    {1661, 88},
+    {2217, 88},
+    {1174, 89},
+    {1975, 89},
+    {1661, 88},
+    {1396, 88},
+    {1244, 89},
+    {2489, 89},
+    {2093, 89},
+    {1661, 88},
+    {1244, 89},
+    {2217, 89},
+    {1864, 89},
+    {1567, 88},
+    {1396, 89},
+    {3322, 89},
+    {3135, 88},
+    {2793, 88},
+    {2489, 89},
+    {2217, 89},
+    {2093, 88},
+    {1396, 88},
+    {2217, 89},
+    {3135, 89},
+    {2793, 89},
+    {2489, 88},
+    {2349, 89},
+    {2093, 89},
+    {1975, 89},
+    {1567, 88},
+    {2093, 89},
+    {2793, 89},
+    {2489, 88},
+    {2217, 88},
+    {2093, 89},
+    {1864, 89},
+    {1760, 88},
+    {1396, 88},
+    {1864, 89},
+    {2489, 89},
+    {2217, 89},
+    {2093, 88},
+    {1864, 89},
+    {1661, 89},
+    {1567, 89},
+    {1244, 88},
+    {1661, 89},
+    {2217, 89},
+    {2093, 88},
+    {1864, 88},
+    {1661, 89},
+    {1567, 89},
+    {1396, 88},
+    {1244, 88},
+    {1174, 89},
+    {1396, 89},
+    {1661, 89},
+    {1975, 88},
+    {2349, 89},
+    {2793, 89},
+    {3322, 89},
+    {2349, 88},
+    {3322, 89},
+    {2489, 89},
+    {2093, 88},
+    {1661, 88},
+    {1244, 89},
+    {1046, 89},
+    {830, 88},
+    {622, 88},
+    {3135, 89},
+    {2489, 89},
+    {1864, 89},
+    {1567, 88},
+    {1244, 89},
+    {932, 89},
+    {783, 89},
+    {622, 88},
+    {698, 89},
+    {3322, 89},
+    {3135, 89},
+    {2959, 88},
+    {2793, 89},
+    {2637, 89},
+    {2489, 88},
+    {2349, 88},
+    {2217, 89},
+    {2093, 89},
+    {1975, 89},
+    {1864, 88},
+    {1760, 89},
+    {1661, 89},
+    {1567, 89},
+    {1479, 88},
+    {1396, 89},
+    {1318, 89},
+    {1244, 88},
+    {1174, 88},
+    {1108, 89},
+    {1046, 89},
+    {987, 88},
+    {932, 88},
+    {830, 89},
+    {1046, 89},
+    {1396, 89},
+    {1244, 88},
+    {783, 89},
+    {1244, 89},
+    {1108, 89},
+    {932, 88},
+    {830, 89},
+    {1046, 89},
+    {622, 88},
+    {830, 88},
+    {783, 89},
+    {1244, 89},
+    {1108, 88},
+    {932, 88},
+    {830, 89},
+    {1046, 89},
+    {622, 89},
+    {830, 88},
+    {783, 89},
+    {1244, 89},
+    {1108, 89},
+    {932, 88},
+    {830, 89},
+    {1244, 89},
+    {1046, 88},
+    {830, 88},
+    {739, 89},
+    {1244, 89},
+    {1046, 88},
+    {739, 88},
+    {698, 89},
+    {1108, 89},
+    {830, 89},
+    {698, 88},
+    {622, 89},
+    {1046, 89},
+    {739, 89},
+    {622, 88},
+    {698, 89},
+    {2217, 89},
+    {1661, 88},
+    {1396, 88},
+    {1244, 89},
+    {2093, 89},
+    {1760, 88},
+    {1244, 88},
+    {1108, 89},
+    {1864, 89},
+    {1396, 89},
+    {1108, 88},
+    {1046, 89},
+    {1760, 89},
+    {1244, 89},
+    {1046, 88},
+    {1108, 89},
+    {1864, 89},
+    {1396, 88},
+    {1108, 88},
+    {987, 89},
+    {1661, 89},
+    {1396, 88},
+    {987, 88},
+    {932, 89},
+    {1479, 89},
+    {1108, 89},
+    {932, 88},
+    {830, 89},
+    {1396, 89},
+    {987, 89},
+    {830, 88},
+    {932, 89},
+    {2959, 89},
+    {2217, 88},
+    {1864, 88},
+    {1661, 89},
+    {2793, 89},
+    {2349, 88},
+    {1661, 88},
+    {1479, 89},
+    {2489, 89},
+    {1864, 89},
+    {1479, 88},
+    {1396, 89},
+    {2349, 89},
+    {1661, 89},
+    {1396, 88},
+    {1479, 89},
+    {2489, 89},
+    {1864, 88},
+    {1479, 88},
+    {1318, 89},
+    {2217, 89},
+    {1864, 88},
+    {1318, 88},
+    {1244, 89},
+    {1975, 89},
+    {1479, 89},
+    {1244, 88},
+    {1108, 89},
+    {1864, 89},
+    {1318, 89},
+    {1108, 88},
+    {1244, 89},
+    {3951, 89},
+    {2959, 88},
+    {2489, 88},
+    {2217, 89},
+    {3729, 89},
+    {3135, 88},
+    {2217, 88},
+    {1975, 89},
+    {3322, 89},
+    {2489, 89},
+    {1975, 88},
+    {1864, 89},
+    {3135, 89},
+    {2217, 89},
+    {1864, 88},
+    {1661, 89},
+    {3322, 89},
+    {3135, 88},
+    {2959, 88},
+    {2793, 89},
+    {2637, 89},
+    {2489, 88},
+    {2349, 88},
+    {2217, 89},
+    {2093, 89},
+    {1975, 89},
+    {1864, 88},
+    {1760, 89},
+    {1661, 89},
+    {1567, 89},
+    {1479, 88},
+    {1396, 89},
+    {1318, 89},
+    {1244, 88},
+    {1174, 88},
+    {1108, 89},
+    {1046, 89},
+    {987, 88},
+    {932, 88},
+    {830, 89},
+    {987, 89},
+    {1318, 89},
+    {1244, 88},
+    {783, 89},
+    {1244, 89},
+    {1108, 89},
+    {932, 88},
+    {830, 89},
+    {2637, 89},
+    {2489, 88},
+    {2349, 88},
+    {2217, 89},
+    {2093, 89},
+    {1975, 88},
+    {1864, 88},
+    {1760, 89},
+    {1661, 89},
+    {1567, 89},
+    {1479, 88},
+    {1396, 89},
+    {1318, 89},
+    {1244, 89},
+    {1174, 88},
+    {1108, 89},
+    {1046, 89},
+    {987, 88},
+    {932, 88},
+    {880, 89},
+    {830, 89},
+    {783, 88},
+    {739, 88},
+    {659, 89},
+    {1108, 89},
+    {987, 89},
+    {830, 88},
+    {622, 89},
+    {987, 89},
+    {880, 89},
+    {739, 88},
+    {659, 89},
+    {1318, 89},
+    {987, 88},
+    {830, 88},
+    {783, 89},
+    {1174, 89},
+    {987, 88},
+    {830, 88},
+    {739, 89},
+    {1479, 89},
+    {1108, 89},
+    {880, 88},
+    {783, 89},
+    {1318, 89},
+    {1108, 89},
+    {932, 88},
+    {830, 89},
+    {1661, 89},
+    {1244, 89},
+    {987, 88},
+    {880, 89},
+    {1479, 89},
+    {1244, 88},
+    {880, 88},
+    {739, 89},
+    {1244, 89},
+    {1046, 89},
+    {1661, 88},
+    {1244, 89},
+    {2093, 89},
+    {1661, 89},
+    {2959, 88},
+    {2637, 89},
+    {2217, 89},
+    {1661, 88},
+    {1318, 88},
+    {1046, 89},
+    {1108, 89},
+    {1318, 88},
+    {1108, 88},
+    {987, 89},
+    {880, 89},
+    {830, 89},
+    {739, 88},
+    {1396, 89},
+    {1479, 89},
+    {1760, 89},
+    {1479, 88},
+    {1318, 89},
+    {1244, 89},
+    {1108, 88},
+    {987, 88},
+    {1864, 89},
+    {1975, 89},
+    {2489, 88},
+    {1975, 88},
+    {2637, 89},
+    {1975, 89},
+    {1661, 89},
+    {1318, 88},
+    {1244, 89},
+    {1318, 89},
+    {1174, 89},
+    {987, 88},
+    {880, 89},
+    {1108, 89},
+    {1318, 88},
+    {1108, 88},
+    {987, 89},
+    {1174, 89},
+    {1318, 88},
+    {1174, 88},
+    {1108, 89},
+    {1760, 89},
+    {1661, 89},
+    {1479, 88},
+    {1318, 89},
+    {1174, 89},
+    {1108, 89},
+    {987, 88},
+    {880, 89},
+    {1108, 89},
+    {1318, 88},
+    {1108, 88},
+    {880, 89},
+    {1318, 89},
+    {1567, 88},
+    {1318, 88},
+    {932, 89},
+    {1318, 89},
+    {1567, 89},
+    {1318, 88},
+    {987, 89},
+    {1174, 89},
+    {1479, 89},
+    {1174, 88},
+    {987, 89},
+    {1244, 89},
+    {1479, 88},
+    {1244, 88},
+    {1108, 89},
+    {1318, 89},
+    {1479, 88},
+    {1318, 88},
+    {1244, 89},
+    {1975, 89},
+    {1864, 89},
+    {1661, 88},
+    {1479, 89},
+    {1318, 89},
+    {1244, 89},
+    {1108, 88},
+    {987, 89},
+    {1244, 89},
+    {1479, 88},
+    {1244, 88},
+    {987, 89},
+    {1479, 89},
+    {1760, 88},
+    {1479, 88},
+    {1046, 89},
+    {1479, 89},
+    {1760, 89},
+    {1479, 88},
+    {1108, 89},
+    {1318, 89},
+    {1661, 89},
+    {1318, 88},
+    {1174, 89},
+    {1975, 89},
+    {1661, 88},
+    {1174, 88},
+    {1108, 89},
+    {2217, 89},
+    {1760, 88},
+    {1479, 88},
+    {1318, 89},
+    {2217, 89},
+    {1864, 89},
+    {1318, 88},
+    {1174, 89},
+    {2349, 89},
+    {1975, 89},
+    {1479, 88},
+    {1174, 89},
+    {2093, 89},
+    {1760, 88},
+    {1479, 88},
+    {1174, 89},
+    {1046, 89},
+    {880, 88},
+    {739, 88},
+    {783, 89},
+    {987, 89},
+    {1174, 89},
+    {1567, 88},
+    {1975, 89},
+    {2349, 89},
+    {3135, 89},
+    {3951, 88},
+    {987, 89},
+    {1760, 89},
+    {1479, 88},
+    {1244, 88},
+    {987, 89},
+    {880, 89},
+    {739, 88},
+    {622, 88},
+    {659, 89},
+    {783, 89},
+    {987, 89},
+    {1318, 88},
+    {1567, 89},
+    {1975, 89},
+    {2637, 89},
+    {3135, 88},
+    {1046, 89},
+    {1318, 89},
+    {1567, 88},
+    {1318, 88},
+    {1174, 89},
+    {1396, 89},
+    {1567, 88},
+    {1396, 88},
+    {1318, 89},
+    {1567, 89},
+    {2093, 89},
+    {1567, 88},
+    {1396, 89},
+    {1661, 89},
+    {2093, 89},
+    {1661, 88},
+    {1479, 89},
+    {1760, 89},
+    {2349, 88},
+    {1760, 88},
+    {1567, 89},
+    {1975, 89},
+    {2349, 88},
+    {1975, 88},
+    {1661, 89},
+    {1975, 89},
+    {2637, 89},
+    {1975, 88},
+    {1760, 89},
+    {2093, 89},
+    {2959, 89},
+    {2093, 88},
+    {1975, 89},
+    {2349, 89},
+    {3135, 88},
+    {2349, 88},
+    {2093, 89},
+    {2637, 89},
+    {3135, 88},
+    {2637, 88},
+    {2093, 89},
+    {2489, 89},
+    {2959, 89},
+    {2489, 88},
+    {1975, 89},
+    {2349, 89},
+    {3135, 89},
+    {2349, 88},
+    {1864, 89},
+    {2217, 89},
+    {2637, 88},
+    {2217, 88},
+    {1760, 89},
+    {2093, 89},
+    {2793, 88},
+    {2093, 88},
+    {1661, 89},
+    {1975, 89},
+    {2349, 89},
+    {1975, 88},
+    {1567, 89},
+    {1864, 89},
+    {2489, 89},
+    {1864, 88},
+    {1479, 89},
+    {1760, 89},
+    {2093, 88},
+    {1760, 88},
+    {1396, 89},
+    {1661, 89},
+    {2217, 88},
+    {1661, 88},
+    {1396, 89},
+    {1661, 89},
+    {1975, 89},
+    {1661, 88},
+    {1318, 89},
+    {1567, 89},
+    {2093, 89},
+    {1567, 88},
+    {1244, 89},
+    {1479, 89},
+    {1760, 88},
+    {1479, 88},
+    {1174, 89},
+    {1396, 89},
+    {1864, 88},
+    {1396, 88},
+    {1108, 89},
+    {1396, 89},
+    {1864, 89},
+    {1396, 88},
+    {1108, 89},
+    {1396, 89},
+    {1975, 89},
+    {1396, 88},
+    {1046, 96},
+    {1318, 96},
+    {1567, 96},
+    {2093, 96},
+    {2637, 96},
+    {3135, 96},
+    {4186, 96},
+    {5274, 96},
+    {2217, 93},
+    {2793, 93},
+    {3729, 93},
+    {2793, 93},
+    {2217, 93},
+    {2793, 93},
+    {3951, 93},
+    {2793, 93},
+    {2093, 96},
+    {2637, 96},
+    {3135, 96},
+    {4186, 96},
+    {5274, 99},
+    {6271, 99},
+    {8372, 99},
+    {10548, 99},
+    {2793, 89},
+    {3322, 89},
+    {4186, 89},
+    {3322, 88},
+    {3135, 89},
+    {3729, 89},
+    {4186, 89},
+    {3729, 88},
+    {3322, 89},
+    {5587, 89},
+    {4978, 88},
+    {4434, 88},
+    {4186, 89},
+    {3729, 89},
+    {3322, 88},
+    {3135, 88},
+    {2793, 89},
+    {3322, 89},
+    {4186, 89},
+    {3322, 88},
+    {3135, 89},
+    {3729, 89},
+    {4186, 89},
+    {3729, 88},
+    {3322, 89},
+    {5587, 89},
+    {4978, 88},
+    {4434, 88},
+    {4186, 89},
+    {3729, 89},
+    {3520, 88},
+    {2793, 88},
+    {3729, 89},
+    {4978, 89},
+    {4434, 89},
+    {4186, 88},
+    {3729, 89},
+    {3322, 89},
+    {3135, 89},
+    {2489, 88},
+    {3322, 89},
+    {4434, 89},
+    {4186, 88},
+    {3729, 88},
+    {3322, 89},
+    {3135, 89},
+    {2793, 88},
+    {2217, 88},
+    {3135, 89},
+    {4186, 89},
+    {3729, 89},
+    {3322, 88},
+    {3135, 89},
+    {2793, 89},
+    {2637, 89},
+    {2093, 88},
+    {2793, 89},
+    {3729, 89},
+    {3322, 88},
+    {3135, 88},
+    {2793, 89},
+    {2489, 89},
+    {2217, 88},
+    {2093, 88},
+    {1975, 89},
+    {3322, 89},
+    {2793, 89},
+    {2349, 88},
+    {1975, 89},
+    {1661, 89},
+    {1396, 89},
+    {987, 88},
+    {3322, 89},
+    {2793, 89},
+    {2093, 88},
+    {1661, 88},
+    {1396, 89},
+    {1046, 89},
+    {830, 88},
+    {698, 88},
+    {3135, 89},
+    {2637, 89},
+    {1864, 89},
+    {1567, 88},
+    {1318, 89},
+    {932, 89},
+    {783, 89},
+    {659, 88},
+    {698, 89},
+    {2793, 89},
+    {2637, 88},
+    {2489, 88},
+    {2349, 89},
+    {2217, 89},
+    {2093, 88},
+    {1975, 88},
+    {1864, 89},
+    {1760, 89},
+    {1661, 89},
+    {1567, 88},
+    {1479, 89},
+    {1396, 89},
+    {1318, 89},
+    {1244, 88},
+    {1174, 89},
+    {1108, 89},
+    {1046, 88},
+    {987, 88},
+    {932, 89},
+    {880, 89},
+    {830, 88},
+    {783, 88},
+    {698, 89},
+    {830, 89},
+    {1108, 89},
+    {1046, 88},
+    {659, 89},
+    {1046, 89},
+    {932, 89},
+    {783, 88},
+    {698, 89},
+    {830, 89},
+    {783, 88},
+    {932, 88},
+    {830, 89},
+    {1046, 89},
+    {659, 88},
+    {783, 88},
+    {698, 89},
+    {830, 89},
+    {783, 89},
+    {932, 88},
+    {830, 89},
+    {1046, 89},
+    {659, 89},
+    {783, 88},
+    {698, 93},
+    {830, 93},
+    {783, 93},
+    {932, 93},
+    {830, 99},
+    {1046, 99},
+    {659, 99},
+    {783, 99},
+    {698, 114},
+    {830, 114},
+    {783, 114},
+    {EV_ARTIC, 177},
+    {932, 114},
+    {EV_ARTIC, 179},
+    {830, 135},
+    {1046, 135},
+    {659, 135},
+    {EV_ARTIC, 176},
+    {783, 135},
+    {EV_ARTIC, 256},
+    {698, 1714},
+    {880, 71},
+    {1046, 71},
+    {1396, 71},
+    {1760, 71},
+    {2093, 71},
+    {2793, 71},
+    {3520, 71},
+    {4186, 71},
+    {EV_VIBRATO, 25},
+    {EV_ARTIC, 228},
+    {5587, 856},
+    {EV_ARTIC, 249},
+    {5274, 71},
+    {4698, 71},
+    {4186, 71},
+    {3729, 71},
+    {3520, 71},
+    {3135, 71},
+    {2793, 71},
+    {2637, 71},
+    {2349, 71},
+    {2093, 71},
+    {1864, 71},
+    {1760, 71},
+    {1567, 71},
+    {1396, 71},
+    {1318, 71},
+    {1174, 71},
+    {1046, 71},
+    {932, 71},
+    {880, 71},
+    {783, 71},
+    {EV_ARTIC, 228},
+    {698, 856},
+    {EV_ARTIC, 249},
+    {880, 71},
+    {1046, 71},
+    {1396, 71},
+    {1760, 71},
+    {2093, 71},
+    {2793, 71},
+    {3520, 71},
+    {4186, 71},
+    {5587, 71},
+    {EV_VIBRATO, 25},
+    {EV_ARTIC, 228},
+    {7040, 856},
+    {EV_ARTIC, 249},
+    {6271, 71},
+    {5587, 71},
+    {5274, 71},
+    {4698, 71},
+    {4186, 71},
+    {3729, 71},
+    {3520, 71},
+    {3135, 71},
+    {2793, 71},
+    {2637, 71},
+    {2349, 71},
+    {2093, 71},
+    {1864, 71},
+    {1760, 71},
+    {1567, 71},
+    {1396, 71},
+    {1318, 71},
+    {1174, 71},
+    {1046, 71},
+    {932, 71},
+    {880, 71},
+    {783, 71},
+    {EV_ARTIC, 228},
+    {698, 856},
+    {EV_ARTIC, 249},
+    {880, 71},
+    {1046, 71},
+    {1396, 71},
+    {1760, 71},
+    {2093, 71},
+    {2793, 71},
+    {3520, 71},
+    {4186, 71},
+    {5587, 71},
+    {7040, 71},
+    {EV_VIBRATO, 25},
+    {EV_ARTIC, 228},
+    {8372, 856},
+    {EV_ARTIC, 249},
+    {7458, 71},
+    {7040, 71},
+    {6271, 71},
+    {5587, 71},
+    {5274, 71},
+    {4698, 71},
+    {4186, 71},
+    {3729, 71},
+    {3520, 71},
+    {3135, 71},
+    {2793, 71},
+    {2637, 71},
+    {2349, 71},
+    {2093, 71},
+    {1864, 71},
+    {1760, 71},
+    {1567, 71},
+    {1396, 71},
+    {1318, 71},
+    {1174, 71},
+    {1046, 71},
+    {932, 71},
+    {880, 71},
+    {783, 71},
+    {EV_ARTIC, 228},
+    {698, 856},
+    {EV_ARTIC, 249},
+    {880, 71},
+    {1046, 71},
+    {1396, 71},
+    {1760, 71},
+    {2093, 71},
+    {2793, 71},
+    {3520, 71},
+    {4186, 71},
+    {5587, 71},
+    {7040, 71},
+    {8372, 71},
+    {EV_VIBRATO, 25},
+    {EV_ARTIC, 228},
+    {11175, 856},
+    {EV_ARTIC, 249},
+    {10548, 71},
+    {9397, 71},
+    {8372, 71},
+    {7458, 71},
+    {7040, 71},
+    {6271, 71},
+    {5587, 71},
+    {5274, 71},
+    {4698, 71},
+    {4186, 71},
+    {3729, 71},
+    {3520, 71},
+    {3135, 71},
+    {2793, 71},
+    {2637, 71},
+    {2349, 71},
+    {2093, 71},
+    {1864, 71},
+    {1760, 71},
+    {1567, 71},
+    {1396, 71},
+    {1318, 71},
+    {1174, 71},
+    {1046, 71},
+    {932, 71},
+    {880, 71},
+    {EV_ARTIC, 248},
+    {783, 70},
+    {EV_ARTIC, 255},
+    {698, 450},
+    {739, 75},
+    {783, 75},
+    {830, 75},
+    {880, 75},
+    {932, 75},
+    {987, 75},
+    {1046, 75},
+    {1108, 75},
+    {1174, 68},
+    {1244, 68},
+    {1318, 68},
+    {1396, 68},
+    {1479, 68},
+    {1567, 68},
+    {1661, 68},
+    {1760, 68},
+    {1864, 62},
+    {1975, 62},
+    {2093, 62},
+    {2217, 62},
+    {2349, 62},
+    {2489, 62},
+    {2637, 62},
+    {2793, 62},
+    {2637, 62},
+    {2489, 62},
+    {2349, 62},
+    {2217, 62},
+    {2093, 68},
+    {1975, 68},
+    {1864, 68},
+    {1760, 68},
+    {1661, 71},
+    {1567, 71},
+    {1479, 71},
+    {1396, 71},
+    {1318, 71},
+    {1244, 71},
+    {1174, 71},
+    {1108, 71},
+    {1046, 75},
+    {987, 75},
+    {932, 75},
+    {880, 75},
+    {830, 83},
+    {783, 83},
+    {EV_ARTIC, 246},
+    {739, 82},
+    {EV_ARTIC, 256},
+    {698, 999},
+    {EV_ARTIC, 252},
+    {880, 135},
+    {EV_ARTIC, 256},
+    {1760, 727},
+};
+
+const uint16_t song_length = sizeof (song) / sizeof (song[0]);
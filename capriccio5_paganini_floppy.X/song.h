@@ -0,0 +1,8 @@
+#ifndef SONG_H
+#define SONG_H
+
+#define SONG_TITLE "Paganini - Capriccio n.5."
+#define FREQ_DIVISOR 16 //step frequency = song frequency / FREQ_DIVISOR
+#define REVERSE_STEPS 140 //LA0 toggles between two head direction inversions
+
+#endif
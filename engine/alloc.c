@@ -0,0 +1,149 @@
+//Note to drive allocator, apart from the engine so that it builds on the host
+//too: tools/floppysim.py compiles it with gcc and drives it with the songs.
+#include <stdint.h>
+#include "song.h"
+#include "alloc.h"
+
+drive_t drive[DRIVES];
+uint8_t unison[UNISON_MAX], unison_n = 1;
+uint8_t alloc_policy = ALLOC_POLICY;
+uint8_t alloc_stolen; //alloc_note() took the drive from a sounding note
+//Every busy drive is linked in three lists: the age list, the list of its
+//priority and the list of its channel, slots 0, 1 and 2 of alloc_next[].
+drive_list_t alloc_list[1 + PRIORITIES + CHANNELS];
+uint8_t alloc_next[3][DRIVES], alloc_prev[3][DRIVES];
+uint8_t alloc_free[DRIVES], alloc_free_n; //stack of the idle drives
+uint8_t alloc_double[DRIVES], alloc_double_n; //stack of the unison doubles, in no list
+
+//A note on takes an idle drive from the stack, or steals the head of one list,
+//so it costs the same for any number of busy drives; only ALLOC_PRIORITY looks
+//at up to PRIORITIES list heads. The caller stops the note of a stolen drive
+//(alloc_stolen) before starting the new one.
+void alloc_link(uint8_t s, uint8_t l, uint8_t d) { //append d to list l through slot s
+    alloc_next[s][d] = NO_DRIVE;
+    alloc_prev[s][d] = alloc_list[l].tail;
+    if (alloc_list[l].tail == NO_DRIVE) alloc_list[l].head = d;
+    else alloc_next[s][alloc_list[l].tail] = d;
+    alloc_list[l].tail = d;
+}
+
+void alloc_unlink(uint8_t s, uint8_t l, uint8_t d) {
+    if (alloc_prev[s][d] == NO_DRIVE) alloc_list[l].head = alloc_next[s][d];
+    else alloc_next[s][alloc_prev[s][d]] = alloc_next[s][d];
+    if (alloc_next[s][d] == NO_DRIVE) alloc_list[l].tail = alloc_prev[s][d];
+    else alloc_prev[s][alloc_next[s][d]] = alloc_prev[s][d];
+}
+
+uint8_t alloc_pinned(uint8_t d) { //drive 0 kept out of the lists for the bass
+    return DRIVES > 1 && d == 0 && (alloc_policy & ALLOC_BASS_PIN);
+}
+
+void alloc_reset(uint8_t policy) { //all drives idle
+    uint8_t i;
+    alloc_policy = policy;
+    for (i = 0; i < 1 + PRIORITIES + CHANNELS; i++) {
+        alloc_list[i].head = NO_DRIVE;
+        alloc_list[i].tail = NO_DRIVE;
+    }
+    alloc_free_n = 0;
+    alloc_double_n = 0;
+    for (i = DRIVES; i-- > 0;) {
+        drive[i].frequency = 0;
+        if (!alloc_pinned(i)) alloc_free[alloc_free_n++] = i;
+    }
+}
+
+uint8_t alloc_note(uint16_t frequency, uint8_t channel, uint8_t priority) { //drive or NO_DRIVE
+    uint8_t d = NO_DRIVE, p;
+    channel &= CHANNELS - 1;
+    if (priority >= PRIORITIES) priority = PRIORITIES - 1;
+    if (DRIVES > 1 && (alloc_policy & ALLOC_BASS_PIN) && frequency < BASS_SPLIT) d = 0;
+    else if (alloc_free_n != 0) d = alloc_free[--alloc_free_n];
+    else if (alloc_double_n != 0) d = alloc_double[--alloc_double_n]; //before any note
+    else switch (alloc_policy & ~ALLOC_BASS_PIN) {
+        case ALLOC_PRIORITY:
+            for (p = 0; p <= priority && d == NO_DRIVE; p++) d = alloc_list[1 + p].head;
+            break;
+        case ALLOC_CHANNEL:
+            d = alloc_list[1 + PRIORITIES + channel].head;
+            if (d == NO_DRIVE) d = alloc_list[0].head;
+            break;
+        default:
+            d = alloc_list[0].head;
+            break;
+    }
+    if (d == NO_DRIVE) return NO_DRIVE; //every drive plays a higher priority
+    alloc_stolen = drive[d].frequency != 0;
+    if (alloc_stolen && !alloc_pinned(d) && drive[d].priority < PRIORITIES) {
+        alloc_unlink(0, 0, d);
+        alloc_unlink(1, 1 + drive[d].priority, d);
+        alloc_unlink(2, 1 + PRIORITIES + drive[d].channel, d);
+    }
+    drive[d].frequency = frequency;
+    drive[d].channel = channel;
+    drive[d].priority = priority;
+    if (!alloc_pinned(d)) {
+        alloc_link(0, 0, d);
+        alloc_link(1, 1 + priority, d);
+        alloc_link(2, 1 + PRIORITIES + channel, d);
+    }
+    return d;
+}
+
+uint8_t alloc_release(uint16_t frequency, uint8_t channel) { //drive of the note off or NO_DRIVE
+    uint8_t d;
+    channel &= CHANNELS - 1;
+    if (DRIVES > 1 && (alloc_policy & ALLOC_BASS_PIN) && drive[0].frequency == frequency
+            && drive[0].channel == channel) {
+        drive[0].frequency = 0;
+        return 0;
+    }
+    for (d = alloc_list[1 + PRIORITIES + channel].head; d != NO_DRIVE; d = alloc_next[2][d]) {
+        if (drive[d].frequency != frequency) continue;
+        alloc_unlink(0, 0, d);
+        alloc_unlink(1, 1 + drive[d].priority, d);
+        alloc_unlink(2, 1 + PRIORITIES + channel, d);
+        drive[d].frequency = 0;
+        alloc_free[alloc_free_n++] = d;
+        return d;
+    }
+    return NO_DRIVE; //stolen already
+}
+
+//A note of EV_VELOCITY v plays on 1 + (v - 1) * UNISON_MAX / 128 drives, all
+//stepping at its rate. The doubles only come from idle drives and stay out of
+//the lists, on a stack that alloc_note() takes from before stealing a note, so
+//a loud note never starves another voice. Fills unison[], returns its first drive.
+uint8_t alloc_unison(uint16_t frequency, uint8_t channel, uint8_t priority, uint8_t velocity) {
+    uint8_t d, n = 1, stolen;
+    if (velocity != 0) n += (uint8_t) (((uint16_t) (velocity - 1) * UNISON_MAX) >> 7);
+    d = alloc_note(frequency, channel, priority);
+    stolen = alloc_stolen;
+    unison_n = 0;
+    if (d == NO_DRIVE) return NO_DRIVE;
+    unison[unison_n++] = d;
+    if (alloc_pinned(d)) return d; //the bass drive plays alone
+    while (unison_n < n && alloc_free_n != 0) {
+        d = alloc_free[--alloc_free_n];
+        drive[d].frequency = frequency;
+        drive[d].channel = channel & (CHANNELS - 1);
+        drive[d].priority = PRIORITIES;
+        alloc_double[alloc_double_n++] = d;
+        unison[unison_n++] = d;
+    }
+    alloc_stolen = stolen;
+    return unison[0];
+}
+
+void alloc_unison_release(uint16_t frequency, uint8_t channel) {
+    uint8_t i, d;
+    channel &= CHANNELS - 1;
+    alloc_release(frequency, channel);
+    for (i = alloc_double_n; i-- > 0;) {
+        d = alloc_double[i];
+        if (drive[d].frequency != frequency || drive[d].channel != channel) continue;
+        drive[d].frequency = 0;
+        alloc_double[i] = alloc_double[--alloc_double_n];
+        alloc_free[alloc_free_n++] = d;
+    }
+}
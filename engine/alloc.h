@@ -0,0 +1,59 @@
+#ifndef ALLOC_H
+#define ALLOC_H
+
+#include <stdint.h>
+
+#ifndef DRIVES
+#if FANOUT_DRIVES
+#define DRIVES FANOUT_DRIVES
+#else
+#define DRIVES 1 //floppy drives the note allocator hands out
+#endif
+#endif
+#ifndef UNISON_MAX
+#if DRIVES < 4
+#define UNISON_MAX DRIVES
+#else
+#define UNISON_MAX 4 //drives of a note at EV_VELOCITY 127
+#endif
+#endif
+#define NO_DRIVE 0xFF
+#define CHANNELS 16 //score, UART or MIDI channels, power of 2
+#define PRIORITIES 4 //note priorities 0 (lowest) to 3
+
+//note stealing policies of alloc_note(), used when every drive is busy
+#define ALLOC_OLDEST   0 //the note that started first
+#define ALLOC_PRIORITY 1 //the oldest note of the lowest priority, never a higher one
+#define ALLOC_CHANNEL  2 //the oldest note of the same channel, else the oldest
+#define ALLOC_BASS_PIN 0x80 //flag: notes under BASS_SPLIT Hz own drive 0, alone
+#ifndef ALLOC_POLICY
+#define ALLOC_POLICY ALLOC_OLDEST
+#endif
+#ifndef BASS_SPLIT
+#define BASS_SPLIT 200 //Hz, song frequency
+#endif
+
+typedef struct { //note a drive plays
+    uint16_t frequency; //0 free
+    uint8_t channel, priority; //priority PRIORITIES: doubles a note in unison
+} drive_t;
+
+typedef struct { //busy drives in note on order
+    uint8_t head, tail; //NO_DRIVE when empty
+} drive_list_t;
+
+extern drive_t drive[DRIVES];
+extern uint8_t alloc_policy, alloc_stolen;
+extern uint8_t unison[UNISON_MAX], unison_n; //drives of the last alloc_unison(), the one it returns first
+extern uint8_t alloc_double[DRIVES], alloc_double_n;
+
+void alloc_link(uint8_t s, uint8_t l, uint8_t d);
+void alloc_unlink(uint8_t s, uint8_t l, uint8_t d);
+uint8_t alloc_pinned(uint8_t d);
+void alloc_reset(uint8_t policy);
+uint8_t alloc_note(uint16_t frequency, uint8_t channel, uint8_t priority);
+uint8_t alloc_release(uint16_t frequency, uint8_t channel);
+uint8_t alloc_unison(uint16_t frequency, uint8_t channel, uint8_t priority, uint8_t velocity);
+void alloc_unison_release(uint16_t frequency, uint8_t channel);
+
+#endif
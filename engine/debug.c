@@ -0,0 +1,151 @@
+#include <xc.h>
+#include <stdint.h>
+#include <string.h>
+#include "engine.h"
+
+#ifdef INSTRUMENT
+stat_t isr_stat, latency_stat, note_stat, voice_stat;
+uint16_t instr_ring_isr[INSTR_RING], instr_ring_lat[INSTR_RING];
+uint8_t instr_head = 0, instr_count = 0;
+uint16_t instr_lat, instr_lost = 0, instr_note_t0, instr_voice_t0;
+
+void INSTR_Initialize(void) { //free running cycle counter
+    T3CONbits.TMR3ON = 0;
+    T3CONbits.TMR3CS = 0; //Timer3 clock source is instruction clock (FOSC/4)
+    T3CONbits.T3RD16 = 1;
+    T3CONbits.T3CKPS = 0; //1:1 Prescale value
+    TMR3 = 0x0000;
+    PIE2bits.TMR3IE = 0;
+    T3CONbits.TMR3ON = 1;
+}
+
+void stat_add(stat_t * st, uint16_t v) {
+    uint8_t k = 0;
+    uint16_t limit = 2;
+    if (st->count == 0 || v < st->min) st->min = v;
+    if (st->count == 0 || v > st->max) st->max = v;
+    st->sum += v;
+    st->count++;
+    while (k < 7 && v >= limit) {
+        k++;
+        limit <<= 2;
+    }
+    st->hist[k]++;
+}
+
+void stat_print(const char * name, stat_t * st) {
+    uint8_t k;
+    put_str(name);
+    put_str(" n=");
+    put_uint(st->count);
+    put_str(" min=");
+    put_uint(st->min);
+    put_str(" max=");
+    put_uint(st->max);
+    put_str(" mean=");
+    put_uint(st->count ? (uint16_t) (st->sum / st->count) : 0); //never above max
+    put_nl();
+    for (k = 0; k < 8; k++) {
+        putch(' ');
+        put_uint(st->hist[k]);
+    }
+    put_nl();
+}
+
+void stats_fold(void) { //move the ISR samples into the stats, called from the main loop
+    uint8_t tail;
+    while (instr_count > 0) {
+        tail = (instr_head - instr_count) & (INSTR_RING - 1);
+        stat_add(&isr_stat, instr_ring_isr[tail]);
+        stat_add(&latency_stat, instr_ring_lat[tail] << 3);
+        INTCONbits.GIE = 0;
+        instr_count--;
+        INTCONbits.GIE = 1;
+    }
+}
+
+void stats_dump(void) { //print and clear the stats
+    stats_fold();
+    put_str("cycles, histogram buckets <2 <8 <32 <128 <512 <2k <8k more\n\r");
+    stat_print("isr", &isr_stat);
+    stat_print("isr latency", &latency_stat);
+    stat_print("note start", &note_stat);
+    stat_print("voice tick", &voice_stat);
+    put_str("lost ");
+    put_uint(instr_lost);
+    put_nl();
+    memset(&isr_stat, 0, sizeof (stat_t));
+    memset(&latency_stat, 0, sizeof (stat_t));
+    memset(&note_stat, 0, sizeof (stat_t));
+    memset(&voice_stat, 0, sizeof (stat_t));
+    instr_lost = 0;
+}
+#endif
+
+#ifdef TRACE
+trace_t trace_ring[TRACE_SIZE];
+uint8_t trace_head = 0, trace_count = 0;
+uint8_t trace_tx[7], trace_tx_len = 0, trace_tx_pos = 0; //record being sent
+uint16_t trace_lost = 0;
+
+void TRACE_Initialize(void) { //trace timestamp timer
+    T0CONbits.TMR0ON = 0;
+    T0CONbits.T08BIT = 0; //16 bit
+    T0CONbits.T0CS = 0; //instruction clock (FOSC/4)
+    T0CONbits.PSA = 0;
+    T0CONbits.T0PS = 0b101; //1:64 Prescale value, 4 us per count
+    TMR0 = 0x0000;
+    INTCONbits.TMR0IF = 0;
+    INTCONbits.TMR0IE = 0;
+    T0CONbits.TMR0ON = 1;
+}
+
+void trace_put(uint8_t type, uint16_t arg) { //called from both main and ISR()
+    uint8_t gie = INTCONbits.GIE;
+    trace_t * t;
+    INTCONbits.GIE = 0;
+    if (trace_count < TRACE_SIZE) {
+        t = &trace_ring[(trace_head + trace_count) & (TRACE_SIZE - 1)];
+        t->type = type;
+        t->time = TMR0;
+        t->arg = arg;
+        trace_count++;
+    } else trace_lost++;
+    INTCONbits.GIE = gie;
+}
+
+uint8_t trace_poll(void) { //sends at most one byte, returns 1 while there is more
+    trace_t * t;
+    if (INTCONbits.TMR0IF) {
+        INTCONbits.TMR0IF = 0;
+        trace_put(TRACE_WRAP, 0);
+    }
+    if (trace_tx_pos == trace_tx_len) {
+        if (trace_lost > 0 && trace_count < TRACE_SIZE) {
+            trace_put(TRACE_LOST, trace_lost);
+            trace_lost = 0;
+        }
+        if (trace_count == 0) return 0;
+        t = &trace_ring[trace_head];
+        trace_tx[0] = TRACE_SYNC;
+        trace_tx[1] = t->type;
+        trace_tx[2] = (uint8_t) t->time;
+        trace_tx[3] = (uint8_t) (t->time >> 8);
+        trace_tx[4] = (uint8_t) t->arg;
+        trace_tx[5] = (uint8_t) (t->arg >> 8);
+        trace_tx[6] = trace_tx[1] ^ trace_tx[2] ^ trace_tx[3] ^ trace_tx[4] ^ trace_tx[5];
+        trace_tx_len = 7;
+        trace_tx_pos = 0;
+        INTCONbits.GIE = 0;
+        trace_head = (trace_head + 1) & (TRACE_SIZE - 1);
+        trace_count--;
+        INTCONbits.GIE = 1;
+    }
+    if ((uint8_t) (tx_head - tx_tail) < TX_SIZE) tx_put(trace_tx[trace_tx_pos++]);
+    return 1;
+}
+
+void trace_flush(void) { //ends the record on the wire, so text is never mixed into it
+    while (trace_tx_pos < trace_tx_len) tx_put(trace_tx[trace_tx_pos++]);
+}
+#endif
@@ -0,0 +1,96 @@
+#ifndef DEBUG_H
+#define DEBUG_H
+
+//Debug builds, all off by default. Enable them in the project macros
+//(define-macros in the XC8 compiler options) or uncomment them here.
+
+//#define INSTRUMENT //ISR cycles, ISR latency and note start time
+//#define TRACE //event trace, decode the UART capture with tools/trace_decode.py
+//#define PROBE //debug pins for a logic analyzer, see tools/vcd_probe.py
+
+#ifdef INSTRUMENT
+#define INSTR_RING 16 //ISR samples waiting to be folded in the stats, power of 2
+
+typedef struct {
+    uint16_t min, max, count;
+    uint32_t sum;
+    uint16_t hist[8]; //bucket k holds values below 2^(2k+1), the last one the rest
+} stat_t;
+
+extern stat_t isr_stat, latency_stat, note_stat, voice_stat; //all values in instruction cycles
+extern uint16_t instr_ring_isr[INSTR_RING], instr_ring_lat[INSTR_RING];
+extern uint8_t instr_head, instr_count;
+extern uint16_t instr_lat, instr_lost, instr_note_t0, instr_voice_t0;
+
+void INSTR_Initialize(void);
+void stat_add(stat_t * st, uint16_t v);
+void stat_print(const char * name, stat_t * st);
+void stats_fold(void);
+void stats_dump(void);
+
+//Timer3 runs free at FOSC/4, so one count is one instruction cycle
+#define INSTR_ISR_ENTER() uint16_t instr_t0 = TMR3
+#define INSTR_ISR_LATENCY() instr_lat = TMR1 //counts since TMR1 overflow, 8 cycles each
+#define INSTR_ISR_EXIT() do { \
+        if (instr_count < INSTR_RING) { \
+            instr_ring_isr[instr_head] = TMR3 - instr_t0; \
+            instr_ring_lat[instr_head] = instr_lat; \
+            instr_head = (instr_head + 1) & (INSTR_RING - 1); \
+            instr_count++; \
+        } else instr_lost++; \
+    } while (0)
+#define INSTR_NOTE_START() instr_note_t0 = TMR3
+#define INSTR_NOTE_ON() stat_add(&note_stat, TMR3 - instr_note_t0)
+#define INSTR_VOICE_START() instr_voice_t0 = TMR3
+#define INSTR_VOICE_END() stat_add(&voice_stat, TMR3 - instr_voice_t0)
+#else
+#define INSTR_ISR_ENTER()
+#define INSTR_ISR_LATENCY()
+#define INSTR_ISR_EXIT()
+#define INSTR_NOTE_START()
+#define INSTR_NOTE_ON()
+#define INSTR_VOICE_START()
+#define INSTR_VOICE_END()
+#endif
+
+#ifdef TRACE
+#define TRACE_SIZE 64 //records in the ring, power of 2
+#define TRACE_SYNC 0xA5 //first byte of every record on the wire, never sent in console text
+
+#define TRACE_NOTE_ON  1 //arg = song frequency
+#define TRACE_NOTE_OFF 2
+#define TRACE_DIR      3 //arg = new LA1 level
+#define TRACE_RELOAD   4 //arg = TMR1 reload value
+#define TRACE_RX       5 //arg = received character
+#define TRACE_WRAP     6 //Timer0 overflowed, keeps the host timeline unambiguous
+#define TRACE_LOST     7 //arg = records dropped because the ring was full
+
+typedef struct {
+    uint8_t type;
+    uint16_t time; //Timer0, 4 us per count
+    uint16_t arg;
+} trace_t;
+
+void TRACE_Initialize(void);
+void trace_put(uint8_t type, uint16_t arg);
+uint8_t trace_poll(void);
+void trace_flush(void);
+
+#define TRACE_EVENT(type, arg) trace_put(type, arg)
+#else
+#define TRACE_EVENT(type, arg)
+#endif
+
+#ifdef PROBE
+//RB0 high while in ISR() (high priority only), RB1 high while a note sounds,
+//RB2 pulses on direction flips
+#define PROBE_ISR(v) LATBbits.LB0 = v
+#define PROBE_NOTE(v) LATBbits.LB1 = v
+#define PROBE_DIR(v) LATBbits.LB2 = v
+#else
+#define PROBE_ISR(v)
+#define PROBE_NOTE(v)
+#define PROBE_DIR(v)
+#endif
+
+#endif
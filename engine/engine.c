@@ -0,0 +1,1343 @@
+#include <xc.h>
+#include <stdint.h>
+#include "engine.h"
+
+uint16_t offset;
+uint8_t cnt = 0, on = 0;
+uint8_t reverse = REVERSE_STEPS;
+uint16_t drum_lfsr = 0xACE1;
+
+uint8_t play_state = STATE_IDLE, loop_on = 0;
+uint16_t song_pos = 0;
+uint16_t loop_a = LOOP_UNSET, loop_b = 0;
+uint16_t tempo_scale = 256;
+uint16_t score_tempo = 256;
+uint32_t tempo_acc;
+int32_t tempo_step;
+uint16_t tempo_target, tempo_ramp = 0, tempo_left = 0;
+score_state_t score_now, score_a;
+uint16_t artic_score = 256, artic_live = 256;
+int8_t transpose = 0;
+voice_t voice;
+
+
+uint8_t clock_level = CLOCK_HIGH; //set by OSCILLATOR_Initialize()
+uint8_t clock_next = CLOCK_HIGH; //level of the next song event
+
+volatile uint8_t tick = 0; //counted up by ISR() every ms
+volatile uint8_t rx_buf[RX_SIZE], rx_head = 0; //filled by ISR()
+uint8_t rx_tail = 0;
+volatile uint8_t tx_buf[TX_SIZE], tx_head = 0, tx_tail = 0; //drained by ISR_low()
+
+const uint16_t power10[4] = {10000, 1000, 100, 10}; //put_uint() digits
+
+//127 sin(2 pi k / LFO_SIZE), the vibrato waveform
+const int8_t lfo_sine[LFO_SIZE] = {
+    0, 12, 25, 37, 49, 60, 71, 81, 90, 98, 106, 112, 117, 122, 125, 126,
+    127, 126, 125, 122, 117, 112, 106, 98, 90, 81, 71, 60, 49, 37, 25, 12,
+    0, -12, -25, -37, -49, -60, -71, -81, -90, -98, -106, -112, -117, -122, -125, -126,
+    -127, -126, -125, -122, -117, -112, -106, -98, -90, -81, -71, -60, -49, -37, -25, -12
+};
+
+//The hits, in Timer1 counts of 0.5 us. The kick's 37 steps and the hat's one
+//stay within the REVERSE_STEPS travel, the snare chatters between two tracks.
+const drum_t drum_kit[DRUMS] = {
+    {30, 400, 40, REVERSE_STEPS, 0}, //kick: 200 us half period falling to 780 us
+    {20, 240, 0, 2, 0x7F}, //snare: 120 to 183 us
+    {1, 960, 0, REVERSE_STEPS, 0} //hat: 480 us, one step in the ms
+};
+
+//2^(k/12) for k = 0..11, 1.15 fixed point
+const uint16_t semitone_ratio[12] = {
+    32768, 34716, 36781, 38968, 41285, 43740,
+    46341, 49097, 52016, 55109, 58386, 61858
+};
+
+void OSCILLATOR_Initialize(void) {
+    // setup oscillator
+    OSCCONbits.SCS = 0b00; // primary clock determined by CONFIG1H
+    OSCCONbits.IRCF = 0b111; // 16 MHz internal oscillator
+    OSCTUNEbits.PLLEN = 1; // Enable PLL
+    while (OSCCONbits.HFIOFS == 0); // busy-wait until high frequency
+    // oscillator becomes stable
+    // now, using 16MHz + 4xPLL, we have an FOSC of 64 MHz
+}
+
+void TIMER1_Initialize(void) { //tone generator timer
+    T1CONbits.TMR1ON = 0; //stop the timer
+    T1CONbits.TMR1CS = 0; //Timer1 clock source is instruction clock (FOSC/4)
+    T1CONbits.T1RD16 = 1; //Enables register read/write of Timer1 in one 16-bit operation
+    T1CONbits.T1CKPS = 3; //1:8 Prescale value
+    TMR1 = 0x0000;
+    PIR1bits.TMR1IF = 0;
+    IPR1bits.TMR1IP = 1; //high priority, ISR()
+    PIE1bits.TMR1IE = 1;
+}
+
+void TIMER2_Initialize(void) { //1 ms timebase for the note durations
+    T2CONbits.TMR2ON = 0;
+    T2CONbits.T2CKPS = 0b10; //1:16 Prescale value
+    T2CONbits.T2OUTPS = 0b0011; //1:4 Postscale value
+    PR2 = 249; //16 MHz / 16 / 250 / 4 = 1 kHz
+    TMR2 = 0;
+    PIR1bits.TMR2IF = 0;
+    IPR1bits.TMR2IP = 0; //low priority, ISR_low()
+    PIE1bits.TMR2IE = 1; //wakes wait_tick() from idle
+    T2CONbits.TMR2ON = 1;
+}
+
+#if FANOUT_DRIVES
+uint16_t fan_acc[FANOUT_DRIVES], fan_inc[FANOUT_DRIVES]; //phase accumulator per drive
+uint8_t fan_cnt[FANOUT_DRIVES]; //half periods since the last direction inversion
+uint8_t fan_rev[FANOUT_DRIVES]; //reverse of each drive
+uint8_t fan_out[FANOUT_BYTES]; //latched by the next tick
+
+//Step and direction lines of FANOUT_DRIVES drives on chained 74HC595: SDO1
+//(RC5) to SER, SCK1 (RC3) to SRCLK, RC2 to RCLK of every register. The
+//register next to the PIC gets fan_out[0]: drive 8k+b steps on output b of
+//register k, its direction is on output b of register k + FANOUT_BYTES/2.
+void FANOUT_Initialize(void) {
+    uint8_t i;
+    TRISCbits.TRISC2 = 0;
+    TRISCbits.TRISC3 = 0;
+    TRISCbits.TRISC5 = 0;
+    LATCbits.LC2 = 0;
+    SSP1CON1bits.SSPEN = 0;
+    SSP1STATbits.CKE = 1; //the 595 shifts on the rising SCK edge
+    SSP1CON1bits.CKP = 0;
+    SSP1CON1bits.SSPM = 0b1010; //SPI master, FOSC / (4 * (SSP1ADD + 1))
+    SSP1ADD = 1; //8 MHz SCK at 64 MHz
+    SSP1CON1bits.SSPEN = 1;
+    for (i = 0; i < FANOUT_DRIVES; i++) fan_rev[i] = REVERSE_STEPS;
+    T4CONbits.TMR4ON = 0;
+    T4CONbits.T4CKPS = 0b10; //1:16 Prescale value, 1 MHz at 64 MHz
+    PR4 = FANOUT_TICK_US - 1;
+    TMR4 = 0;
+    PIR5bits.TMR4IF = 0;
+    IPR5bits.TMR4IP = 1; //high priority, ISR()
+    PIE5bits.TMR4IE = 1;
+    T4CONbits.TMR4ON = 1;
+}
+
+void fanout_set(uint8_t d, uint16_t half) { //half period in Timer1 counts, 0 is silence
+    uint32_t inc = 0;
+    if (d >= FANOUT_DRIVES) return;
+    if (half != 0) {
+        inc = ((uint32_t) FANOUT_TICK_US * 2 << 16) / half; //toggles per tick, 0.16
+        if (inc > 65535) inc = 65535; //above the tick rate the drive steps every tick
+    }
+    INTCONbits.GIEH = 0;
+    fan_inc[d] = (uint16_t) inc;
+    INTCONbits.GIEH = 1;
+}
+
+//One burst per tick: the bits computed at the last tick go out first, so every
+//latch comes at the same point of the tick whatever the number of toggles.
+void fanout_tick(void) {
+    uint8_t i, j, mask;
+    uint16_t a;
+    for (j = FANOUT_BYTES; j-- > 0;) { //the far end of the chain first
+        SSP1BUF = fan_out[j];
+        while (!SSP1STATbits.BF); //8 SCK, 16 cycles, counted in FANOUT_CYCLES
+        (void) SSP1BUF;
+    }
+    LATCbits.LC2 = 1; //every output of the chain changes on this edge
+    LATCbits.LC2 = 0;
+    j = 0;
+    mask = 1;
+    for (i = 0; i < FANOUT_DRIVES; i++) { //the bits of the next tick
+        a = fan_acc[i] + fan_inc[i];
+        if (a < fan_acc[i]) { //a half period is over
+            fan_out[j] ^= mask;
+            if (++fan_cnt[i] >= fan_rev[i] && on == 1) {
+                fan_cnt[i] = 0;
+                fan_out[j + FANOUT_BYTES / 2] ^= mask;
+            }
+        }
+        fan_acc[i] = a;
+        mask <<= 1;
+        if (mask == 0) {
+            mask = 1;
+            j++;
+        }
+    }
+}
+
+void fanout_home(void) { //every head to 0, as main() does for the one drive
+    uint8_t i;
+    uint16_t half = (uint16_t) ((double) 1000000 / (double) (698 / FREQ_DIVISOR));
+    for (i = 0; i < FANOUT_DRIVES; i++) fanout_set(i, half);
+    sleep(2714);
+    for (i = 0; i < FANOUT_DRIVES; i++) fanout_set(i, 0);
+    INTCONbits.GIEH = 0;
+    for (i = FANOUT_BYTES / 2; i < FANOUT_BYTES; i++) fan_out[i] = ~fan_out[i];
+    for (i = 0; i < FANOUT_DRIVES; i++) fan_cnt[i] = 0;
+    INTCONbits.GIEH = 1;
+    sleep(1714);
+}
+
+void unison_set(uint16_t half) { //fanout_set() of every drive of the note
+    uint8_t k;
+    for (k = 0; k < unison_n; k++) fanout_set(unison[k], half);
+}
+
+//Each double takes the step level, direction and inversion count of the first
+//drive, then runs voice.spread behind the drive before it.
+void unison_phase(void) {
+    uint8_t k, d, b0, m0, b, m;
+    b0 = unison[0] >> 3;
+    m0 = (uint8_t) (1 << (unison[0] & 7));
+    INTCONbits.GIEH = 0;
+    for (k = 1; k < unison_n; k++) {
+        d = unison[k];
+        b = d >> 3;
+        m = (uint8_t) (1 << (d & 7));
+        fan_out[b] = fan_out[b0] & m0 ? fan_out[b] | m : fan_out[b] & ~m;
+        b += FANOUT_BYTES / 2;
+        fan_out[b] = fan_out[b0 + FANOUT_BYTES / 2] & m0 ? fan_out[b] | m : fan_out[b] & ~m;
+        fan_cnt[d] = fan_cnt[unison[0]];
+        fan_rev[d] = fan_rev[unison[0]];
+        fan_acc[d] = fan_acc[unison[k - 1]] - ((uint16_t) voice.spread << 8);
+    }
+    INTCONbits.GIEH = 1;
+}
+#endif
+
+void UART_Initialize(void) {
+    ANSELA = 0;
+    ANSELC = 0;
+    // setup UART
+    TRISCbits.TRISC6 = 0; // TX
+    TRISCbits.TRISC7 = 1; // RX
+
+    TXSTA1bits.SYNC = 0;
+    TXSTA1bits.TX9 = 0;
+    TXSTA1bits.TXEN = 1;
+
+    RCSTA1bits.RX9 = 0;
+    RCSTA1bits.CREN = 1;
+    RCSTA1bits.SPEN = 1;
+
+    BAUDCON1bits.BRG16 = 1; //baud = FOSC / (4 (SPBRG + 1)), fine enough on
+    TXSTA1bits.BRGH = 1; //every clock level of clock_set()
+    //SPBRG = 138; // 115200
+    SPBRGH1 = 832 >> 8; // 19200
+    SPBRG1 = 832 & 0xFF;
+    IPR1bits.TX1IP = 0; //low priority, ISR_low(), TX1IE set by putch()
+    IPR1bits.RC1IP = 0; //low priority, ISR_low()
+    PIE1bits.RC1IE = 1; //received bytes go to rx_buf, wakes read_char() from idle
+}
+
+#if BUS_ADDRESS
+volatile uint8_t bus_frame[BUS_FRAMES][BUS_FRAME], bus_head = 0; //filled by ISR_low()
+uint8_t bus_tail = 0;
+uint8_t bus_pos, bus_left = 0; //ISR_low() place in the frame, bytes still to come
+bus_event_t bus_event[BUS_EVENTS]; //filled by bus_poll()
+uint8_t bus_ev_head = 0, bus_ev_tail = 0;
+uint16_t bus_ok = 0, bus_crc = 0, bus_late = 0;
+volatile uint16_t bus_lost = 0; //counted by ISR_low() and bus_queue()
+volatile uint32_t bus_stamp[BUS_FRAMES];
+volatile uint32_t sync_ms = 0;
+volatile int16_t sync_trim = 0;
+int16_t sync_acc = 0; //ISR_low() sigma-delta of sync_trim over PR2
+int16_t sync_err = 0; //error of the last beacon, ms
+int32_t sync_sum = 0; //integral of the loop
+uint8_t sync_lock = 0; //a beacon set the time
+
+//RS-485 multi-drop bus, receive only: RX2 (RB7) from the RO pin of the
+//transceiver, RE and DE tied low. A frame is an address byte with the 9th bit
+//set, then with it clear a type byte, the payload and a CRC-8 of all of them.
+//ADDEN lets only address bytes in until one is BUS_ADDRESS or BUS_BROADCAST,
+//so the frames of the other boards cost no interrupt.
+void BUS_Initialize(void) {
+    TRISBbits.TRISB7 = 1;
+    TXSTA2bits.SYNC = 0;
+    BAUDCON2bits.BRG16 = 1; //baud = FOSC / (4 (SPBRG + 1))
+    TXSTA2bits.BRGH = 1;
+    SPBRGH2 = (uint8_t) (((_XTAL_FREQ / 4 + BUS_BAUD / 2) / BUS_BAUD - 1) >> 8);
+    SPBRG2 = (uint8_t) (((_XTAL_FREQ / 4 + BUS_BAUD / 2) / BUS_BAUD - 1) & 0xFF);
+    RCSTA2bits.RX9 = 1;
+    RCSTA2bits.ADDEN = 1;
+    RCSTA2bits.CREN = 1;
+    RCSTA2bits.SPEN = 1;
+    IPR3bits.RC2IP = 0; //low priority, ISR_low()
+    PIE3bits.RC2IE = 1;
+}
+
+uint8_t crc8(uint8_t crc, uint8_t b) { //polynomial x^8 + x^2 + x + 1, MSB first, from 0
+    uint8_t i;
+    crc ^= b;
+    for (i = 0; i < 8; i++) {
+        if (crc & 0x80) crc = (uint8_t) (crc << 1) ^ 0x07;
+        else crc <<= 1;
+    }
+    return crc;
+}
+
+uint8_t bus_poll(void) { //decodes the frames ISR_low() took, 1 if one was BUS_STOP
+    volatile uint8_t * f;
+    bus_event_t e;
+    uint8_t i, len, crc, stop = 0;
+    while (bus_tail != bus_head) {
+        f = bus_frame[bus_tail & (BUS_FRAMES - 1)];
+        len = (f[1] & 0x0F) + 2; //address and type first
+        crc = 0;
+        for (i = 0; i < len; i++) crc = crc8(crc, f[i]);
+        if (crc != f[len]) bus_crc++;
+        else if (f[1] == BUS_NOTE || f[1] == BUS_AT) {
+            e.channel = f[2] & (CHANNELS - 1);
+            e.n.frequency = f[3] | (uint16_t) f[4] << 8;
+            e.n.ms = f[5] | (uint16_t) f[6] << 8;
+            e.at = (uint16_t) bus_stamp[bus_tail & (BUS_FRAMES - 1)];
+            if (f[1] == BUS_AT) {
+                if ((int16_t) ((f[7] | (uint16_t) f[8] << 8) - e.at) < 0) bus_late++; //plays now
+                else e.at = f[7] | (uint16_t) f[8] << 8;
+            }
+            bus_queue(&e);
+            bus_ok++;
+        } else if (f[1] == BUS_SYNC) {
+            sync_beacon(f[2] | (uint16_t) f[3] << 8 | (uint32_t) (f[4] | (uint16_t) f[5] << 8) << 16,
+                    bus_stamp[bus_tail & (BUS_FRAMES - 1)]);
+            bus_ok++;
+        } else {
+            if (f[1] == BUS_STOP) {
+                bus_ev_tail = bus_ev_head;
+                stop = 1;
+            }
+            bus_ok++; //other kinds are skipped, their length is known
+        }
+        bus_tail++;
+    }
+    return stop;
+}
+
+//Insertion into the time sorted ring, equal times stay in arrival order. The
+//host sends in time order, so an event mostly goes at the end.
+void bus_queue(bus_event_t * e) {
+    uint8_t i = bus_ev_head, j;
+    if ((uint8_t) (bus_ev_head - bus_ev_tail) >= BUS_EVENTS) {
+        INTCONbits.GIEL = 0;
+        bus_lost++;
+        INTCONbits.GIEL = 1;
+        return;
+    }
+    while (i != bus_ev_tail) {
+        j = i - 1;
+        if ((int16_t) (bus_event[j & (BUS_EVENTS - 1)].at - e->at) <= 0) break;
+        bus_event[i & (BUS_EVENTS - 1)] = bus_event[j & (BUS_EVENTS - 1)];
+        i = j;
+    }
+    bus_event[i & (BUS_EVENTS - 1)] = *e;
+    bus_ev_head++;
+}
+
+uint16_t sync_now(void) { //low bits of sync_ms, as in bus_event_t.at
+    uint16_t t;
+    INTCONbits.GIEL = 0;
+    t = (uint16_t) sync_ms;
+    INTCONbits.GIEL = 1;
+    return t;
+}
+
+//The master sends its time every SYNC_MS. Each board keeps sync_ms on it with a
+//PI loop on the length of its 1 ms tick, so the HFINTOSC error (up to 2%) and
+//its drift with temperature cancel out: the ms of Beep() and sleep() become the
+//ms of the master. The loop has a double pole at 0.7 per beacon, the error
+//falls below 1 ms within about 10 beacons, see tools/bus.py --sync.
+void sync_beacon(uint32_t master, uint32_t stamp) {
+    int32_t e = (int32_t) (master - stamp), t;
+    if (sync_lock == 0 || e > SYNC_STEP_MS || e < -SYNC_STEP_MS) {
+        INTCONbits.GIEL = 0;
+        sync_ms += (uint32_t) e; //the trim found so far is kept
+        INTCONbits.GIEL = 1;
+        sync_lock = 1;
+        sync_err = 0;
+        return;
+    }
+    sync_err = (int16_t) e;
+    sync_sum += e;
+    if (sync_sum > SYNC_TRIM_MAX / SYNC_KI) sync_sum = SYNC_TRIM_MAX / SYNC_KI;
+    if (sync_sum < -SYNC_TRIM_MAX / SYNC_KI) sync_sum = -SYNC_TRIM_MAX / SYNC_KI;
+    t = SYNC_KP * e + SYNC_KI * sync_sum;
+    if (t > SYNC_TRIM_MAX) t = SYNC_TRIM_MAX;
+    if (t < -SYNC_TRIM_MAX) t = -SYNC_TRIM_MAX;
+    INTCONbits.GIEL = 0;
+    sync_trim = (int16_t) t;
+    INTCONbits.GIEL = 1;
+}
+#endif
+
+//Changes FOSC and the prescalers that follow it: on every level Timer2 ticks at
+//1 kHz and the UART runs at 19200 baud, on CLOCK_MID and CLOCK_HIGH Timer1
+//counts at 2 MHz, so a tone keeps its pitch across a switch. The clock and the
+//prescalers change a few cycles apart with GIE clear. The PLL takes up to 2 ms
+//to lock and FOSC only moves to it when PLLRDY is set, so that wait runs with
+//the interrupts on at the old clock and the prescalers follow right after.
+//Timer1 cannot make 2 MHz from CLOCK_LOW: the caller stops the tone first.
+//The queued output is let out first, a byte being received may be lost.
+void clock_set(uint8_t level) {
+#if CLOCK_SCALING
+    uint8_t step;
+    uint16_t brg;
+    while (clock_level != level) {
+        step = level;
+        if (level == CLOCK_HIGH && clock_level == CLOCK_LOW) step = CLOCK_MID; //PLL input
+        while (tx_head != tx_tail || TXSTA1bits.TRMT == 0); //old baud rate until sent
+        if (step == CLOCK_HIGH) {
+            OSCTUNEbits.PLLEN = 1;
+            while (OSCCON2bits.PLLRDY == 0); //steps and ticks go on at 16 MHz
+        }
+        INTCONbits.GIE = 0;
+        switch (step) {
+            case CLOCK_LOW:
+                OSCTUNEbits.PLLEN = 0;
+                OSCCONbits.IRCF = 0b011; //1 MHz
+                T2CONbits.T2CKPS = 0b00; //1 MHz / 4 / 250 = 1 kHz
+                T2CONbits.T2OUTPS = 0b0000;
+                brg = 12; //19231 baud
+                break;
+            case CLOCK_MID:
+                OSCTUNEbits.PLLEN = 0;
+                OSCCONbits.IRCF = 0b111; //16 MHz, HFINTOSC is already stable
+                T1CONbits.T1CKPS = 1; //1:2
+                T2CONbits.T2CKPS = 0b10; //16 MHz / 4 / 16 / 250 = 1 kHz
+                T2CONbits.T2OUTPS = 0b0000;
+                brg = 207; //19231 baud
+                break;
+            default:
+                T1CONbits.T1CKPS = 3; //1:8
+                T2CONbits.T2CKPS = 0b10; //64 MHz / 4 / 16 / 250 / 4 = 1 kHz
+                T2CONbits.T2OUTPS = 0b0011;
+                brg = 832; //19208 baud
+                break;
+        }
+        SPBRGH1 = brg >> 8;
+        SPBRG1 = brg & 0xFF;
+        clock_level = step;
+        INTCONbits.GIE = 1;
+    }
+#else
+    (void) level; //the clock stays at CLOCK_HIGH
+#endif
+}
+
+//Clock level the song needs at event pos: a long rest has no tone to time, a
+//run of short notes gets the PLL for the per note setup of Beep().
+uint8_t clock_plan(uint16_t pos) {
+    uint8_t i, notes = 0;
+    uint32_t ms = 0;
+    note_t n;
+    if (loop_on == 1 && pos >= loop_b) pos = loop_a;
+    while (pos < song_length && song[pos].frequency >= EV_BASE) pos++; //take no time
+    if (pos >= song_length) return CLOCK_LOW; //back to the console prompt
+    n = song[pos];
+    if (n.frequency == 0 && scale_duration(n.ms) > 2 * CLOCK_LEAD_MS) return CLOCK_LOW;
+    for (i = 0; i < DENSE_WINDOW && pos < song_length; i++, pos++) {
+        n = song[pos];
+        if (n.frequency == 0 || n.frequency >= EV_BASE) continue;
+        ms += n.ms;
+        notes++;
+    }
+    ms = (ms * score_tempo) >> 8;
+    if (notes != 0 && ((ms * tempo_scale) >> 8) < (uint32_t) DENSE_MS * notes) return CLOCK_HIGH;
+    return CLOCK_MID;
+}
+
+//Raises the clock for the next event while the current one still has left ms
+//to go, so the PLL lock does not delay the next note.
+void clock_ahead(uint16_t left) {
+    if (left == CLOCK_LEAD_MS && clock_next > clock_level) clock_set(clock_next);
+}
+
+//Console output goes through tx_buf, sent by ISR_low() one byte per TX1IF, so
+//printing a message costs a few cycles per character instead of the ~0.5 ms
+//per character of a busy wait at 19200 baud. Only a full buffer waits.
+void putch(char c) {
+#ifdef TRACE
+    trace_flush();
+#endif
+    tx_put(c);
+}
+
+void tx_put(uint8_t c) {
+    while ((uint8_t) (tx_head - tx_tail) >= TX_SIZE) {
+        INTCONbits.GIEL = 0;
+        if ((uint8_t) (tx_head - tx_tail) >= TX_SIZE) idle();
+        INTCONbits.GIEL = 1;
+    }
+    tx_buf[tx_head & (TX_SIZE - 1)] = c;
+    tx_head++;
+    PIE1bits.TX1IE = 1;
+}
+
+void put_str(const char * s) { //string literals are read straight from flash
+    while (*s) putch(*s++);
+}
+
+void put_nl(void) {
+    putch('\n');
+    putch('\r');
+}
+
+void put_uint(uint16_t v) { //decimal, by subtraction of the powers of 10
+    uint8_t k;
+    char d, lead = 0;
+    for (k = 0; k < 4; k++) {
+        for (d = '0'; v >= power10[k]; d++) v -= power10[k];
+        if (d != '0' || lead) {
+            putch(d);
+            lead = 1;
+        }
+    }
+    putch('0' + (char) v);
+}
+
+void put_int(int16_t v) {
+    if (v < 0) {
+        putch('-');
+        put_uint((uint16_t) (-v));
+    } else put_uint((uint16_t) v);
+}
+
+char read_char(void) {
+    char c;
+    if (rx_head == rx_tail) clock_set(CLOCK_LOW); //nothing plays at the prompt
+    while (rx_head == rx_tail) {
+#ifdef TRACE
+        if (trace_poll()) continue; //no idle while the trace drains
+#endif
+        INTCONbits.GIEL = 0;
+        if (rx_head == rx_tail) idle();
+        INTCONbits.GIEL = 1;
+    }
+    c = rx_buf[rx_tail & (RX_SIZE - 1)];
+    rx_tail++;
+    TRACE_EVENT(TRACE_RX, c);
+    return c;
+}
+
+void read_line(char * s, int max_len) {
+    int i = 0;
+    for (;;) {
+        char c = read_char();
+        if (c == 13) {
+            putch(c);
+            putch(10);
+            s[i] = 0;
+            return;
+        } else if (c == 127 || c == 8) {
+            if (i > 0) {
+                putch(c);
+                putch(' ');
+                putch(c);
+                --i;
+            }
+        } else if (c >= 32) {
+            if (i < max_len - 1) { //room for the terminator
+                putch(c);
+                s[i] = c;
+                ++i;
+            }
+        }
+    }
+}
+
+void Beep(uint16_t frequency, uint16_t duration) {
+    uint16_t i, note = frequency, hit;
+    if (play_state != STATE_IDLE) {
+        frequency = transpose_frequency(frequency);
+        duration = scale_duration(duration);
+    } else tick_reset(); //a console beep
+    hit = drum_hit(duration); //EV_DRUM before the note
+    INSTR_NOTE_START();
+    if (clock_level == CLOCK_LOW) clock_set(CLOCK_MID); //Timer1 needs 2 MHz
+    frequency = (uint16_t) ((double) frequency / FREQ_DIVISOR);
+    offset = (uint16_t) ((double) 65535 - ((double) 1000000 / (double) frequency)); //load start timer value
+    voice_start(65535 - offset, note); //glide, bend and chord
+#if FANOUT_DRIVES
+    unison_phase();
+#else
+    TMR1 = offset;
+    T1CONbits.TMR1ON = 1; //start tone generator timer
+#endif
+    PROBE_NOTE(1);
+    INSTR_NOTE_ON();
+    TRACE_EVENT(TRACE_NOTE_ON, frequency);
+    for (i = hit; i < duration; i++) {
+        clock_ahead(duration - i);
+        wait_tick();
+        if (playback_tick()) break;
+        INSTR_VOICE_START();
+        voice_tick();
+        INSTR_VOICE_END();
+    }
+#if FANOUT_DRIVES
+    unison_set(0);
+#else
+    T1CONbits.TMR1ON = 0; //stop tone generator timer
+#endif
+    PROBE_NOTE(0);
+    TRACE_EVENT(TRACE_NOTE_OFF, 0);
+}
+
+void sleep(uint16_t ms) {
+    uint16_t i;
+    if (play_state != STATE_IDLE) ms = scale_duration(ms);
+    else tick_reset();
+    for (i = drum_hit(ms); i < ms; i++) {
+        clock_ahead(ms - i);
+        wait_tick();
+        if (playback_tick()) break;
+    }
+}
+
+//Plays the EV_DRUM waiting in voice.drum for at most duration ticks, returns
+//the ticks it took. The step rate is set once per tick like a vibrato, with
+//the direction inverted every reverse half periods, so a hit costs the ISR
+//nothing more than a note and the main loop one table step per ms. A hit with
+//its own reverse (the snare) gets the inversion counter and the direction of
+//the sweep back after it, the others step on with the sweep like a note.
+uint16_t drum_hit(uint16_t duration) {
+    const drum_t * d;
+    uint16_t half, i, n;
+#if FANOUT_DRIVES
+    uint8_t k, b, mask, cnt_was[UNISON_MAX], dir_was[UNISON_MAX];
+#else
+    uint8_t cnt_was, dir_was;
+#endif
+    if (voice.drum >= DRUMS) return 0;
+    d = &drum_kit[voice.drum];
+    voice.drum = DRUM_NONE;
+    n = d->ms < duration ? d->ms : duration;
+    if (n == 0) return 0;
+    if (clock_level == CLOCK_LOW) clock_set(CLOCK_MID); //Timer1 needs 2 MHz
+    half = d->half;
+#if FANOUT_DRIVES
+    INTCONbits.GIEH = 0;
+    for (k = 0; k < unison_n; k++) {
+        cnt_was[k] = fan_cnt[unison[k]];
+        dir_was[k] = fan_out[(unison[k] >> 3) + FANOUT_BYTES / 2];
+    }
+    INTCONbits.GIEH = 1;
+#else
+    cnt_was = cnt; //Timer1 is off, ISR() leaves them alone
+    dir_was = LATAbits.LA1;
+#endif
+    drum_set(half);
+#if FANOUT_DRIVES
+    for (k = 0; k < unison_n; k++) fan_rev[unison[k]] = d->reverse;
+#else
+    reverse = d->reverse;
+    TMR1 = offset;
+    T1CONbits.TMR1ON = 1;
+#endif
+    for (i = 0; i < n; i++) {
+        clock_ahead(duration - i);
+        wait_tick();
+        if (playback_tick()) break;
+        INSTR_VOICE_START();
+        half += d->slope;
+        drum_lfsr = (drum_lfsr >> 1) ^ ((drum_lfsr & 1) ? 0xB400 : 0);
+        drum_set(half + (drum_lfsr & d->noise));
+        INSTR_VOICE_END();
+    }
+#if FANOUT_DRIVES
+    unison_set(0);
+    INTCONbits.GIEH = 0;
+    for (k = 0; k < unison_n; k++) {
+        b = (unison[k] >> 3) + FANOUT_BYTES / 2;
+        mask = (uint8_t) (1 << (unison[k] & 7));
+        fan_rev[unison[k]] = REVERSE_STEPS;
+        if (d->reverse == REVERSE_STEPS) continue;
+        fan_cnt[unison[k]] = cnt_was[k];
+        fan_out[b] = (fan_out[b] & ~mask) | (dir_was[k] & mask);
+    }
+    INTCONbits.GIEH = 1;
+#else
+    T1CONbits.TMR1ON = 0;
+    INTCONbits.GIEH = 0; //ISR() compares cnt with reverse
+    reverse = REVERSE_STEPS;
+    if (d->reverse != REVERSE_STEPS) {
+        cnt = cnt_was;
+        LATAbits.LA1 = dir_was;
+    }
+    INTCONbits.GIEH = 1;
+#endif
+    return i < n ? duration : n; //stopped: the event is over too
+}
+
+void drum_set(uint16_t half) { //ISR() loads it at the next edge, as voice_update()
+#if FANOUT_DRIVES
+    unison_set(half);
+#else
+    INTCONbits.GIEH = 0;
+    offset = 65535 - half;
+    INTCONbits.GIEH = 1;
+#endif
+}
+
+//Durations are counted in Timer2 ticks rather than with __delay_ms(): the time
+//spent in ISR() and in the per note setup no longer stretches the song.
+//The CPU idles until the tick, only waking up for the interrupts. Ticks are counted, so
+//the ones elapsed during a PLL lock in clock_set() are caught up.
+void wait_tick(void) {
+    while (tick == 0) {
+        INTCONbits.GIEL = 0;
+        if (tick == 0) idle();
+        INTCONbits.GIEL = 1;
+    }
+    tick--; //a single DECF, atomic against ISR_low()
+}
+
+void tick_reset(void) { //drops the ticks counted while nothing played
+    INTCONbits.GIEL = 0;
+    tick = 0;
+    INTCONbits.GIEL = 1;
+}
+
+//Called with GIEL clear, so a low priority interrupt between the caller's check
+//and SLEEP cannot be missed: a pending enabled interrupt turns SLEEP into a NOP,
+//any new one wakes the core and is serviced as soon as the caller sets GIEL
+//again. ISR() stays enabled and runs straight from the wake up.
+//IDLEN keeps the oscillator and the peripherals running, so waking up takes no
+//oscillator start-up time.
+void idle(void) {
+    OSCCONbits.IDLEN = 1;
+    SLEEP();
+    NOP();
+}
+
+uint16_t scale_duration(uint16_t ms) { //score tempo first, then the console one
+    uint32_t d = ((uint32_t) ms * score_tempo) >> 8;
+    d = (d * tempo_scale) >> 8;
+    if (d > 0xFFFF) d = 0xFFFF;
+    return (uint16_t) d;
+}
+
+//Tempo map of the score. EV_TEMPO sets the duration multiplier at once, or,
+//after an EV_TEMPO_RAMP, moves it there by the same step at every timed event,
+//so an accelerando is one event pair over notes written at a fixed tempo.
+void tempo_reset(void) {
+    score_tempo = 256;
+    tempo_ramp = 0;
+    tempo_left = 0;
+}
+
+void tempo_next(void) { //called before every timed event
+    if (tempo_left == 0) return;
+    tempo_acc += tempo_step;
+    if (--tempo_left == 0) score_tempo = tempo_target; //no rounding left over
+    else score_tempo = (uint16_t) (tempo_acc >> 8);
+}
+
+//The A-B loop jumps back with the score state loop_a started with, so a loop
+//across an EV_TEMPO, a ramp, an EV_ARTIC or an EV_VELOCITY replays as its
+//first pass did.
+void score_save(score_state_t * s) {
+    s->score_tempo = score_tempo;
+    s->tempo_target = tempo_target;
+    s->tempo_ramp = tempo_ramp;
+    s->tempo_left = tempo_left;
+    s->tempo_acc = tempo_acc;
+    s->tempo_step = tempo_step;
+    s->artic_score = artic_score;
+    s->voice = voice;
+}
+
+void score_load(const score_state_t * s) {
+    score_tempo = s->score_tempo;
+    tempo_target = s->tempo_target;
+    tempo_ramp = s->tempo_ramp;
+    tempo_left = s->tempo_left;
+    tempo_acc = s->tempo_acc;
+    tempo_step = s->tempo_step;
+    artic_score = s->artic_score;
+    voice = s->voice;
+}
+
+void loop_back(void) {
+    song_pos = loop_a;
+    score_load(&score_a);
+}
+
+//A note event holds the time to the next onset; play() sounds the first
+//articulate(ms) of it and rests for the remainder, so the gaps of a score are
+//one ratio rather than a rest event after every note.
+uint16_t articulate(uint16_t ms) {
+    uint32_t gate = ((uint32_t) ms * artic_score) >> 8;
+    gate = (gate * artic_live) >> 8;
+    if (gate > ms) gate = ms;
+    if (gate == 0) gate = 1;
+    return (uint16_t) gate;
+}
+
+uint16_t transpose_frequency(uint16_t frequency) {
+    int8_t n = transpose, octave = 0;
+    uint32_t f;
+    while (n < 0) { //bring n in 0..11, at most 2 octaves
+        n += 12;
+        octave--;
+    }
+    while (n >= 12) {
+        n -= 12;
+        octave++;
+    }
+    f = ((uint32_t) frequency * semitone_ratio[n]) >> 15;
+    if (octave > 0) f <<= octave;
+    if (octave < 0) f >>= -octave;
+    if (f == 0) f = 1;
+    if (f > 0xFFFF) f = 0xFFFF;
+    return (uint16_t) f;
+}
+
+//Pitch moves are kept in 1/256 semitone, so a slide is linear in cents. The
+//half period between two semitones of semitone_ratio[] is interpolated
+//linearly: 0.2 cent at most from the exact curve, no table of its own.
+uint32_t period_factor(uint8_t k) { //2^(-k/12), 0.16 fixed point, k = 0..12
+    if (k == 0) return 65536;
+    return semitone_ratio[12 - k];
+}
+
+uint16_t period_at(uint16_t base, int16_t p) { //half period of base moved by p/256 semitones
+    int8_t octave = 0;
+    uint8_t k;
+    uint32_t a, b, counts;
+    while (p < 0) {
+        p += 12 * 256;
+        octave--;
+    }
+    while (p >= 12 * 256) {
+        p -= 12 * 256;
+        octave++;
+    }
+    k = (uint8_t) (p >> 8);
+    a = period_factor(k);
+    b = period_factor(k + 1);
+    a -= ((a - b) * (uint8_t) p) >> 8;
+    counts = ((uint32_t) base * a) >> 16;
+    if (octave > 0) counts >>= octave;
+    if (octave < 0) counts <<= -octave;
+    if (counts > 65535) counts = 65535;
+    if (counts < MIN_HALF_PERIOD) counts = MIN_HALF_PERIOD;
+    return (uint16_t) counts;
+}
+
+int16_t pitch_between(uint16_t from, uint16_t to) { //p with period_at(to, p) = from
+    int16_t p = 0;
+    uint8_t k;
+    uint32_t f = from, t = to, q;
+    while (f > t) { //whole octaves
+        t <<= 1;
+        p -= 12 * 256;
+    }
+    while (f * 2 <= t) {
+        f <<= 1;
+        p += 12 * 256;
+    }
+    q = (f << 16) / t; //2^(-k/12) for some k in 0..12
+    for (k = 0; k < 11 && q <= period_factor(k + 1); k++);
+    return p + k * 256 + (int16_t) (((period_factor(k) - q) << 8) / (period_factor(k) - period_factor(k + 1)));
+}
+
+void voice_reset(void) {
+    voice.last = 0;
+    voice.slide_ms = 0;
+    voice.glide = 0;
+    voice.gliss = 0;
+    voice.bend_range = 2;
+    voice.bend = 0;
+    voice.lfo_step = 360; //5.5 Hz
+    voice.lfo_depth = 0;
+    voice.lfo = 0;
+    voice.vibrato = 0;
+    voice.chord_n = 0;
+    voice.arp_n = 1;
+    voice.arp_rate = 50;
+    voice.drum = DRUM_NONE;
+    voice.velocity = 0;
+    voice.spread = 0;
+}
+
+void voice_start(uint16_t base, uint16_t frequency) { //called by Beep() before the tone starts
+    uint8_t i;
+    uint32_t b;
+    voice.pitch = 0;
+    voice.slide_ms = 0;
+    if (voice.glide != 0 && voice.last != 0) {
+        voice.slide_ms = scale_duration(voice.glide);
+        if (voice.slide_ms == 0) voice.slide_ms = 1;
+        voice.pitch = (int32_t) pitch_between(voice.last, base) << 8;
+        voice.slide = -voice.pitch / voice.slide_ms;
+    }
+    voice.glide = 0;
+    voice.base = base;
+    voice.last = base;
+    voice.lfo_phase = 0; //the vibrato starts at the scored pitch
+    voice.lfo_depth = voice.vibrato;
+    voice.lfo = 0;
+    voice.vibrato = 0;
+    //a chord is arpeggiated on the drive, its pitches as ratios of the note
+    //so transpose and FREQ_DIVISOR apply to them too
+    voice.arp_base[0] = base;
+    for (i = 0; i < voice.chord_n; i++) {
+        b = ((uint32_t) base * frequency + voice.chord[i] / 2) / voice.chord[i];
+        if (b > 65535) b = 65535;
+        if (b < MIN_HALF_PERIOD) b = MIN_HALF_PERIOD;
+        voice.arp_base[i + 1] = (uint16_t) b;
+    }
+    voice.arp_n = voice.chord_n + 1;
+    voice.arp_i = 0;
+    voice.arp_acc = 0;
+    voice.chord_n = 0;
+    voice_update();
+}
+
+//The per tick cost is bounded: a table read and one multiply for the LFO, an
+//add for the arpeggio, and at most one period_at() when the pitch moved.
+//A new pitch of the chord reaches Timer1 at the next edge like any other.
+void voice_tick(void) { //every ms of a note, after the tick
+    uint8_t moved = 0;
+    int16_t lfo;
+    if (voice.lfo_depth != 0) {
+        voice.lfo_phase += voice.lfo_step;
+        lfo = (int16_t) (((int32_t) lfo_sine[voice.lfo_phase >> 10] * voice.lfo_depth) >> 7);
+        if (lfo != voice.lfo) {
+            voice.lfo = lfo;
+            moved = 1;
+        }
+    }
+    if (voice.arp_n > 1) {
+        voice.arp_acc += voice.arp_rate;
+        if (voice.arp_acc >= 1000) {
+            voice.arp_acc -= 1000;
+            if (++voice.arp_i == voice.arp_n) voice.arp_i = 0;
+            voice.base = voice.arp_base[voice.arp_i];
+            moved = 1;
+        }
+    }
+    if (voice.slide_ms != 0) {
+        voice.pitch += voice.slide;
+        if (--voice.slide_ms == 0) {
+            voice.pitch = 0; //no rounding left over
+            voice.gliss = 0;
+        }
+        moved = 1;
+    }
+    if (moved) voice_update();
+}
+
+void voice_update(void) { //ISR() loads the new period at the next edge
+    int16_t p = (int16_t) (voice.pitch >> 8) + voice.bend;
+    uint16_t o;
+    if (voice.gliss) p = (p + 128) & 0xFF00; //nearest semitone
+    p += voice.lfo;
+    if (p == 0) o = 65535 - voice.base;
+    else o = 65535 - period_at(voice.base, p);
+#if FANOUT_DRIVES
+    unison_set(65535 - o);
+#else
+    INTCONbits.GIEH = 0;
+    offset = o;
+    INTCONbits.GIEH = 1;
+#endif
+}
+
+void control(uint16_t event, uint16_t arg) {
+    switch (event) {
+        case EV_GLIDE:
+        case EV_GLISS:
+            voice.glide = arg;
+            voice.gliss = event == EV_GLISS;
+            break;
+        case EV_BEND_RANGE:
+            voice.bend_range = (uint8_t) arg;
+            break;
+        case EV_BEND:
+            voice.bend = (int16_t) ((((int32_t) arg - 8192) * voice.bend_range) >> 5);
+            break;
+        case EV_VIBRATO_RATE:
+            if (arg > 1000) arg = 1000;
+            voice.lfo_step = (uint16_t) (((uint32_t) arg * 65536 + 5000) / 10000);
+            break;
+        case EV_VIBRATO:
+            if (arg > 1200) arg = 1200;
+            voice.vibrato = (int16_t) (((uint32_t) arg * 256 + 50) / 100);
+            break;
+        case EV_TEMPO:
+            if (arg < 16) arg = 16;
+            if (arg > 4096) arg = 4096;
+            tempo_left = tempo_ramp;
+            tempo_ramp = 0;
+            if (tempo_left == 0) score_tempo = arg;
+            else {
+                tempo_target = arg;
+                tempo_acc = (uint32_t) score_tempo << 8;
+                tempo_step = (((int32_t) arg - score_tempo) << 8) / tempo_left;
+            }
+            break;
+        case EV_TEMPO_RAMP:
+            tempo_ramp = arg;
+            break;
+        case EV_CHORD:
+            if (arg != 0 && arg < EV_BASE && voice.chord_n < ARP_SIZE - 1) voice.chord[voice.chord_n++] = arg;
+            break;
+        case EV_ARP_RATE:
+            if (arg < 1) arg = 1;
+            if (arg > 1000) arg = 1000;
+            voice.arp_rate = arg;
+            break;
+        case EV_VELOCITY:
+            voice.velocity = arg > 127 ? 127 : (uint8_t) arg;
+            break;
+        case EV_SPREAD:
+            voice.spread = arg > 255 ? 255 : (uint8_t) arg;
+            break;
+        case EV_DRUM:
+            voice.drum = arg < DRUMS ? (uint8_t) arg : DRUM_NONE;
+            break;
+        case EV_ARTIC:
+            if (arg < 1) arg = 1;
+            if (arg > 256) arg = 256;
+            artic_score = arg;
+            break;
+    }
+}
+
+void play(void) {
+    note_t n;
+    uint16_t gate;
+    put_str("SPACE pause/resume, s stop, a/b set loop A/B, c clear loop\n\r");
+    put_str("+/- tempo, </> transpose, [/] articulation, = reset them\n\r");
+    play_state = STATE_PLAYING;
+    song_pos = 0;
+    loop_on = 0;
+    loop_a = LOOP_UNSET; //no A left over from the last run
+    voice_reset();
+    tempo_reset();
+    artic_score = 256;
+    alloc_reset(alloc_policy);
+    tick_reset();
+    while (song_pos < song_length && play_state != STATE_STOPPED) {
+        n = song[song_pos++];
+        if (n.frequency >= EV_BASE) {
+            control(n.frequency, n.ms);
+            if (loop_on == 1 && song_pos >= loop_b) loop_back();
+            continue;
+        }
+        score_save(&score_now); //loop_a keeps it
+        tempo_next();
+#if CLOCK_SCALING
+        clock_set(clock_plan(song_pos - 1)); //lowers, or raises if clock_ahead() could not
+        clock_next = clock_plan(song_pos);
+#endif
+        if (n.frequency != 0) {
+            gate = articulate(n.ms);
+            (void) alloc_unison(n.frequency, 0, PRIORITIES - 1, voice.velocity); //the score is channel 0
+            Beep(n.frequency, gate);
+            alloc_unison_release(n.frequency, 0);
+            if (gate < n.ms && play_state != STATE_STOPPED) sleep(n.ms - gate);
+        } else if (voice.drum < DRUMS) { //a hit on the rest, on a drive of its own
+            (void) alloc_unison(DRUM_FREQ, DRUM_CHANNEL, PRIORITIES - 1, voice.velocity);
+            sleep(n.ms);
+            alloc_unison_release(DRUM_FREQ, DRUM_CHANNEL);
+        } else sleep(n.ms);
+        if (loop_on == 1 && song_pos >= loop_b) loop_back();
+    }
+    play_state = STATE_IDLE;
+    clock_next = CLOCK_LOW;
+    voice_reset();
+    tempo_reset();
+    artic_score = 256;
+}
+
+#if BUS_ADDRESS
+void bus_play(void) { //the events come from the bus instead of song[], until s
+    bus_event_t e;
+    uint16_t lost;
+    put_str("bus board ");
+    put_uint(BUS_ADDRESS);
+    put_str(", s stops listening\n\r");
+    play_state = STATE_PLAYING;
+    loop_on = 0;
+    loop_a = LOOP_UNSET;
+    voice_reset();
+    tempo_reset();
+    artic_score = 256;
+    alloc_reset(alloc_policy);
+    tick_reset();
+    while (play_state != STATE_STOPPED) {
+        bus_poll();
+        if (bus_ev_tail == bus_ev_head
+                || (int16_t) (bus_event[bus_ev_tail & (BUS_EVENTS - 1)].at - sync_now()) > 0) {
+            wait_tick(); //the next event is due at a later tick
+            playback_tick();
+            continue;
+        }
+        e = bus_event[bus_ev_tail & (BUS_EVENTS - 1)];
+        bus_ev_tail++;
+        if (e.n.frequency >= EV_BASE) {
+            control(e.n.frequency, e.n.ms);
+            if (e.n.frequency == EV_DRUM && (bus_ev_tail == bus_ev_head
+                    || bus_event[bus_ev_tail & (BUS_EVENTS - 1)].at != e.at)) {
+                (void) alloc_unison(DRUM_FREQ, DRUM_CHANNEL, PRIORITIES - 1, voice.velocity);
+                drum_hit(255); //no note at the same time, the hit plays alone
+                alloc_unison_release(DRUM_FREQ, DRUM_CHANNEL);
+            }
+        } else if (e.n.frequency != 0) { //the host sends no rests, it waits
+            (void) alloc_unison(e.n.frequency, e.channel, PRIORITIES - 1, voice.velocity);
+            Beep(e.n.frequency, e.n.ms);
+            alloc_unison_release(e.n.frequency, e.channel);
+        }
+    }
+    play_state = STATE_IDLE;
+    voice_reset();
+    INTCONbits.GIEL = 0;
+    lost = bus_lost;
+    INTCONbits.GIEL = 1;
+    put_str("bus ");
+    put_uint(bus_ok);
+    put_str(" frames, ");
+    put_uint(bus_crc);
+    put_str(" CRC errors, ");
+    put_uint(lost);
+    put_str(" lost, ");
+    put_uint(bus_late);
+    put_str(" late, sync ");
+    put_int(sync_err);
+    put_str(" ms, trim ");
+    put_int(sync_trim);
+    put_str("/256 us per ms\n\r");
+}
+#endif
+
+uint8_t playback_tick(void) { //called every ms, returns 1 if the event must end
+    uint8_t running, level;
+#ifdef INSTRUMENT
+    stats_fold();
+#endif
+#ifdef TRACE
+    trace_poll();
+#endif
+    console_poll();
+#if BUS_ADDRESS
+    if (bus_poll()) return 1; //BUS_STOP ends the note
+#endif
+    if (play_state == STATE_PAUSED) {
+#if FANOUT_DRIVES
+        running = T4CONbits.TMR4ON;
+        T4CONbits.TMR4ON = 0; //every drive of the chain holds
+#else
+        running = T1CONbits.TMR1ON;
+        T1CONbits.TMR1ON = 0; //LA0, LA1 and cnt are left untouched
+#endif
+        PROBE_NOTE(0);
+        level = clock_level;
+        clock_set(CLOCK_LOW);
+        while (play_state == STATE_PAUSED) {
+            wait_tick();
+#ifdef TRACE
+            trace_poll();
+#endif
+            console_poll();
+        }
+        clock_set(level);
+#if FANOUT_DRIVES
+        T4CONbits.TMR4ON = running;
+#else
+        T1CONbits.TMR1ON = running;
+#endif
+        PROBE_NOTE(running);
+    }
+    if (play_state == STATE_STOPPED) return 1;
+    return 0;
+}
+
+void console_poll(void) {
+    char c;
+    if (play_state == STATE_IDLE || rx_head == rx_tail) return;
+    c = rx_buf[rx_tail & (RX_SIZE - 1)];
+    rx_tail++;
+    TRACE_EVENT(TRACE_RX, c);
+    switch (c) {
+        case ' ':
+            if (play_state == STATE_PLAYING) {
+                play_state = STATE_PAUSED;
+                put_str("pause\n\r");
+            } else if (play_state == STATE_PAUSED) {
+                play_state = STATE_PLAYING;
+                put_str("resume\n\r");
+            }
+            break;
+        case 's':
+            play_state = STATE_STOPPED;
+            put_str("stop\n\r");
+            break;
+        case 'a': //loop from the event being played
+            loop_a = song_pos - 1;
+            score_a = score_now;
+            loop_on = 0;
+            put_str("A ");
+            put_uint(loop_a);
+            put_nl();
+            break;
+        case 'b': //loop up to the event being played, included
+            if (loop_a != LOOP_UNSET && song_pos > loop_a) {
+                loop_b = song_pos;
+                loop_on = 1;
+                put_str("B ");
+                put_uint(loop_b);
+                put_nl();
+            }
+            break;
+        case 'c':
+            loop_on = 0;
+            put_str("loop off\n\r");
+            break;
+        case '+': //faster, takes effect from the next event
+            if (tempo_scale > 64) tempo_scale -= tempo_scale >> 4;
+            put_str("tempo ");
+            put_uint(tempo_scale);
+            put_str("/256\n\r");
+            break;
+        case '-': //slower
+            if (tempo_scale < 1024) tempo_scale += tempo_scale >> 4;
+            put_str("tempo ");
+            put_uint(tempo_scale);
+            put_str("/256\n\r");
+            break;
+        case '[': //shorter notes, longer gaps, from the next note
+            if (artic_live > 64) artic_live -= 16;
+            put_str("articulation ");
+            put_uint(artic_live);
+            put_str("/256\n\r");
+            break;
+        case ']': //longer notes, up to legato
+            if (artic_live < 512) artic_live += 16;
+            put_str("articulation ");
+            put_uint(artic_live);
+            put_str("/256\n\r");
+            break;
+        case '>':
+            if (transpose < 24) transpose++;
+            put_str("transpose ");
+            put_int(transpose);
+            put_nl();
+            break;
+        case '<':
+            if (transpose > -24) transpose--;
+            put_str("transpose ");
+            put_int(transpose);
+            put_nl();
+            break;
+#ifdef INSTRUMENT
+        case 'i':
+            stats_dump();
+            break;
+#endif
+        case '=':
+            tempo_scale = 256;
+            transpose = 0;
+            artic_live = 256;
+            put_str("tempo 256/256, transpose 0, articulation 256/256\n\r");
+            break;
+    }
+}
+
+//High priority: the tone timer only, so a step edge waits for nothing but the
+//vector entry and the code that runs with GIE clear. WREG, STATUS and BSR go
+//to the fast register stack.
+void __interrupt(high_priority) ISR(void) {
+    PROBE_ISR(1);
+    INSTR_ISR_ENTER();
+#if FANOUT_DRIVES
+    if (PIR5bits.TMR4IF) { //step tick of the shift register chain
+        PIR5bits.TMR4IF = 0;
+        fanout_tick();
+    }
+#endif
+    if (PIR1bits.TMR1IF) { //tone generator timer
+        INSTR_ISR_LATENCY();
+        TMR1 = offset;
+        TRACE_EVENT(TRACE_RELOAD, offset);
+        cnt++;
+        LATAbits.LA0 = ~LATAbits.LA0;
+        PIR1bits.TMR1IF = 0;
+    }
+    if (cnt >= reverse && on == 1) { //inversion counter
+        cnt = 0;
+        PROBE_DIR(1);
+        LATAbits.LA1 = ~LATAbits.LA1;
+        PROBE_DIR(0);
+        TRACE_EVENT(TRACE_DIR, LATAbits.LA1);
+    }
+    INSTR_ISR_EXIT();
+    PROBE_ISR(0);
+}
+
+//Low priority: housekeeping, ISR() preempts it anywhere.
+void __interrupt(low_priority) ISR_low(void) {
+#if BUS_ADDRESS
+    int8_t n;
+#endif
+    if (PIR1bits.TMR2IF) { //1 ms timebase
+        PIR1bits.TMR2IF = 0;
+        tick++;
+#if BUS_ADDRESS
+        sync_ms++;
+        sync_acc += sync_trim; //whole 4 us steps of the next ms go to PR2
+        n = (int8_t) (sync_acc >> 10);
+        sync_acc -= (int16_t) n << 10;
+        PR2 = (uint8_t) (249 - n);
+#endif
+    }
+    if (PIR1bits.RC1IF) { //console input, reading RCREG1 clears the flag
+        if (RCSTA1bits.OERR == 1) {
+            RCSTA1bits.CREN = 0;
+            RCSTA1bits.CREN = 1;
+        }
+        if ((uint8_t) (rx_head - rx_tail) < RX_SIZE) {
+            rx_buf[rx_head & (RX_SIZE - 1)] = RCREG1;
+            rx_head++;
+        } else (void) RCREG1; //full, the byte is lost
+    }
+#if BUS_ADDRESS
+    if (PIR3bits.RC2IF) { //RS-485 bus, RX9D must be read before RCREG2
+        uint8_t ninth = RCSTA2bits.RX9D, b;
+        if (RCSTA2bits.OERR == 1) {
+            RCSTA2bits.CREN = 0;
+            RCSTA2bits.CREN = 1;
+        }
+        b = RCREG2;
+        if (ninth) { //an address ends any frame left unfinished
+            bus_left = 0;
+            RCSTA2bits.ADDEN = 1;
+            if (b == BUS_ADDRESS || b == BUS_BROADCAST) {
+                if ((uint8_t) (bus_head - bus_tail) < BUS_FRAMES) {
+                    bus_frame[bus_head & (BUS_FRAMES - 1)][0] = b;
+                    bus_stamp[bus_head & (BUS_FRAMES - 1)] = sync_ms;
+                    bus_pos = 1;
+                    bus_left = 1; //the type, which gives the rest
+                    RCSTA2bits.ADDEN = 0;
+                } else bus_lost++;
+            }
+        } else if (bus_left) {
+            bus_frame[bus_head & (BUS_FRAMES - 1)][bus_pos++] = b;
+            bus_left--;
+            if (bus_pos == 2) {
+                if ((b & 0x0F) > BUS_FRAME - 3) bus_lost++; //too long, dropped
+                else bus_left = (b & 0x0F) + 1;
+            }
+            if (bus_left == 0) {
+                if (bus_pos > 2) bus_head++;
+                RCSTA2bits.ADDEN = 1;
+            }
+        }
+    }
+#endif
+    if (PIE1bits.TX1IE && PIR1bits.TX1IF) { //console output, TXREG1 is free
+        if (tx_tail != tx_head) {
+            TXREG1 = tx_buf[tx_tail & (TX_SIZE - 1)];
+            tx_tail++;
+        } else PIE1bits.TX1IE = 0; //all sent, putch() enables it again
+    }
+}
@@ -0,0 +1,288 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include <xc.h>
+#include <stdint.h>
+#include "song.h" //per project song configuration, found through -I.
+
+#define _XTAL_FREQ 64000000
+
+//defaults for the settings song.h does not give
+#ifndef SONG_TITLE
+#define SONG_TITLE "Floppy music player."
+#endif
+#ifndef FREQ_DIVISOR
+#define FREQ_DIVISOR 4 //step frequency = song frequency / FREQ_DIVISOR
+#endif
+#ifndef REVERSE_STEPS
+#define REVERSE_STEPS 140 //LA0 toggles between two head direction inversions
+#endif
+#ifndef HOMING
+#define HOMING 1 //put the head in 0 position before the song
+#endif
+
+#define RX_SIZE 16 //console receive buffer, power of 2
+#define TX_SIZE 32 //console transmit buffer, power of 2
+
+//clock levels of clock_set(), Timer1 counts at 2 MHz on both tone levels
+#define CLOCK_LOW  0 //1 MHz HFINTOSC, no tone: long rests, pause, console prompt
+#define CLOCK_MID  1 //16 MHz HFINTOSC
+#define CLOCK_HIGH 2 //16 MHz HFINTOSC x 4 PLL = 64 MHz
+#define DENSE_WINDOW 4 //events looked ahead by clock_plan()
+#define DENSE_MS 100 //mean note length under which the PLL is used
+#define CLOCK_LEAD_MS 3 //a clock raise starts this early, covers the 2 ms PLL lock
+
+#ifndef FANOUT_DRIVES
+#define FANOUT_DRIVES 0 //drives on chained 74HC595 fed by MSSP1, 0: one drive on RA0/RA1
+#endif
+#if FANOUT_DRIVES
+#define FANOUT_BYTES (2 * ((FANOUT_DRIVES + 7) / 8)) //step registers, then direction ones
+//Worst case cycles of fanout_tick() in ISR(), every drive toggling: context
+//save and latch, a byte shifted at 8 MHz SCK with the BF wait, a drive
+#define FANOUT_CYCLES (40 + FANOUT_BYTES * 24 + FANOUT_DRIVES * 48)
+#ifndef FANOUT_TICK_US
+#define FANOUT_TICK_US ((FANOUT_CYCLES + 7) / 8) //Timer4 step tick, 1..256 us, half the CPU
+#endif
+#if FANOUT_TICK_US > 256
+#error "FANOUT_DRIVES too many for one Timer4 tick"
+#endif
+#if FANOUT_CYCLES > FANOUT_TICK_US * 16 * 3 / 4
+#error "FANOUT_TICK_US too short for fanout_tick() of FANOUT_DRIVES drives"
+#endif
+#endif
+
+#include "alloc.h"
+
+#ifndef BUS_ADDRESS
+#define BUS_ADDRESS 0 //RS-485 board address on EUSART2, 1..254, 0: no bus
+#endif
+#define BUS_BROADCAST 0xFF //address every board takes
+#if BUS_ADDRESS
+#ifndef BUS_BAUD
+#define BUS_BAUD 250000 //exact at 64 MHz, so are 500000 and 1000000
+#endif
+#define BUS_FRAMES 4 //frames waiting for bus_poll(), power of 2
+#define BUS_FRAME 10 //address, type, up to 7 payload bytes, CRC
+#define BUS_EVENTS 16 //decoded events waiting for bus_play(), power of 2
+#ifndef SYNC_MS
+#define SYNC_MS 1000 //BUS_SYNC period of the master
+#endif
+#define SYNC_STEP_MS 50 //a beacon further off than this sets the time, no loop
+#define SYNC_TRIM_MAX 6144 //1/256 us per ms: 2.4%, PR2 of Timer2 in 243..255
+#define SYNC_KP (128000L / SYNC_MS) //trim per ms of error
+#define SYNC_KI (32000L / SYNC_MS) //trim per ms of summed error
+#endif
+//frame types on the bus, the high nibble is the kind, the low one the payload length
+#define BUS_NOTE 0x15 //channel, frequency, ms: a note_t of the score, control events too
+#define BUS_STOP 0x20 //silence now, drop the events not played yet
+#define BUS_SYNC 0x34 //master time in ms when it started the address byte
+#define BUS_AT 0x17 //BUS_NOTE played when the low 16 bits of sync_ms reach at
+
+#define STATE_IDLE    0 // no song running, Beep() plays unconditionally
+#define STATE_PLAYING 1
+#define STATE_PAUSED  2 // tone timer frozen, head position and direction kept
+#define STATE_STOPPED 3 // the song ends after the current event
+#define LOOP_UNSET 0xFFFF // loop_a before 'a' is pressed in this run
+
+typedef struct {
+    uint16_t frequency; //0 is a rest, EV_BASE and up a control event
+    uint16_t ms; //argument of a control event
+} note_t;
+
+//control events of the score, {EV_GLIDE, 568} in song[]
+#define EV_BASE 0xFF00
+#define EV_GLIDE      (EV_BASE + 1) //the next note slides in from the last pitch in ms
+#define EV_GLISS      (EV_BASE + 2) //the same in semitone steps
+#define EV_BEND_RANGE (EV_BASE + 3) //semitones of a full pitch bend, 2 at start
+#define EV_BEND       (EV_BASE + 4) //0..16383, 8192 is no bend, from the next note
+#define EV_VIBRATO_RATE (EV_BASE + 5) //LFO rate in 1/10 Hz, 55 at start, up to 1000
+#define EV_VIBRATO    (EV_BASE + 6) //vibrato depth of the next note in cents, up to 1200
+#define EV_TEMPO      (EV_BASE + 7) //duration multiplier of the score, 8.8, 256 as written
+#define EV_TEMPO_RAMP (EV_BASE + 8) //the next EV_TEMPO is reached linearly over n events
+#define EV_ARTIC      (EV_BASE + 9) //sounding part of every note, 1/256 of its onset to onset ms
+#define EV_CHORD      (EV_BASE + 10) //song frequency arpeggiated with the next note
+#define EV_ARP_RATE   (EV_BASE + 11) //chord pitches per second, 50 at start, up to 1000
+#define EV_DRUM       (EV_BASE + 12) //DRUM_ hit taking the first ms of the next timed event
+#define EV_VELOCITY   (EV_BASE + 13) //1..127 of the next notes, drives in unison, 0 at start: one
+#define EV_SPREAD     (EV_BASE + 14) //phase of each unison drive after the last, 1/256 half period
+
+//percussion of EV_DRUM, head seeks without a pitch
+#define DRUM_KICK  0 //a long seek one way, its step rate falling
+#define DRUM_SNARE 1 //the direction flipped every step, at a noisy rate
+#define DRUM_HAT   2 //a single step
+#define DRUMS 3
+#define DRUM_NONE 0xFF
+#define DRUM_CHANNEL 9 //channel of the hits on a rest, as in MIDI
+#define DRUM_FREQ 1 //frequency of those hits in drive[], 0 is a free drive
+
+#define MIN_HALF_PERIOD 40 //Timer1 counts, shortest half period a slide can reach
+#define LFO_SIZE 64 //lfo_sine[] entries, one LFO period
+#define ARP_SIZE 4 //pitches of a chord, the note and up to 3 EV_CHORD
+
+typedef struct { //pitch state of the drive
+    uint16_t base; //half period of the note as scored, Timer1 counts
+    uint16_t last; //base of the previous note, a glide starts there, 0 none
+    int32_t pitch; //offset from base, 1/65536 semitone, up is positive
+    int32_t slide; //added to pitch every ms while slide_ms > 0
+    uint16_t slide_ms;
+    uint16_t glide; //ms of the glide into the next note, 0 none
+    uint8_t gliss; //the glide moves in whole semitones
+    uint8_t bend_range;
+    int16_t bend; //1/256 semitone
+    uint16_t lfo_phase; //65536 is one LFO period
+    uint16_t lfo_step; //added to lfo_phase every ms
+    int16_t lfo_depth; //peak of the vibrato of this note, 1/256 semitone, 0 off
+    int16_t lfo; //current vibrato offset, 1/256 semitone
+    int16_t vibrato; //lfo_depth of the next note
+    uint16_t chord[ARP_SIZE - 1]; //EV_CHORD frequencies of the next note
+    uint8_t chord_n;
+    uint16_t arp_base[ARP_SIZE]; //base of each pitch of the chord, the note first
+    uint8_t arp_n, arp_i; //pitches, the one playing
+    uint16_t arp_acc; //arp_rate added every ms, next pitch at 1000
+    uint16_t arp_rate;
+    uint8_t drum; //EV_DRUM of the next timed event, DRUM_NONE
+    uint8_t velocity; //EV_VELOCITY
+    uint8_t spread; //EV_SPREAD
+} voice_t;
+
+typedef struct { //score state at the start of a timed event, for the A-B loop
+    uint16_t score_tempo, tempo_target, tempo_ramp, tempo_left;
+    uint32_t tempo_acc;
+    int32_t tempo_step;
+    uint16_t artic_score;
+    voice_t voice; //bend, chord, velocity and the other controls of the score
+} score_state_t;
+
+typedef struct { //one DRUM_ instrument
+    uint8_t ms; //length of the hit
+    uint16_t half; //first half period, Timer1 counts
+    int16_t slope; //added to half every ms
+    uint8_t reverse; //half periods between direction inversions, 2 chatters
+    uint8_t noise; //mask of the random counts added to half, 0 none
+} drum_t;
+
+typedef struct { //BUS_NOTE or BUS_AT frame
+    note_t n;
+    uint8_t channel;
+    uint16_t at; //sync_ms it plays at, the arrival for BUS_NOTE
+} bus_event_t;
+
+extern const note_t song[]; //song.c
+extern const uint16_t song_length;
+extern const int8_t lfo_sine[LFO_SIZE];
+extern const drum_t drum_kit[DRUMS];
+
+extern uint16_t offset;
+extern uint8_t cnt, on;
+extern uint8_t reverse; //REVERSE_STEPS, but during a hit
+extern uint16_t drum_lfsr;
+extern uint8_t play_state, loop_on;
+extern uint16_t song_pos; //index of the next event of song[]
+extern uint16_t loop_a, loop_b; //A-B loop region, B excluded
+extern uint16_t tempo_scale; //duration multiplier, 8.8 fixed point
+extern uint16_t score_tempo; //duration multiplier of the score, 8.8, EV_TEMPO
+extern uint32_t tempo_acc; //score_tempo during a ramp, 8.16
+extern int32_t tempo_step; //added to tempo_acc every event of a ramp
+extern uint16_t tempo_target, tempo_ramp, tempo_left;
+extern score_state_t score_now, score_a; //of the event playing, of loop_a
+extern uint16_t artic_score; //EV_ARTIC, 256 at start: notes sound for their whole ms
+extern uint16_t artic_live; //console multiplier of artic_score, 8.8
+extern int8_t transpose; //semitones, -24..+24
+extern voice_t voice;
+#if FANOUT_DRIVES
+extern uint16_t fan_acc[FANOUT_DRIVES], fan_inc[FANOUT_DRIVES];
+extern uint8_t fan_cnt[FANOUT_DRIVES], fan_rev[FANOUT_DRIVES];
+extern uint8_t fan_out[FANOUT_BYTES];
+#endif
+#if BUS_ADDRESS
+extern volatile uint8_t bus_frame[BUS_FRAMES][BUS_FRAME], bus_head;
+extern uint8_t bus_tail, bus_pos, bus_left;
+extern bus_event_t bus_event[BUS_EVENTS];
+extern uint8_t bus_ev_head, bus_ev_tail;
+extern uint16_t bus_ok, bus_crc; //frames taken, failed the CRC
+extern volatile uint16_t bus_lost; //frames or events with no room
+extern uint16_t bus_late; //BUS_AT frames that came after their time
+extern volatile uint32_t bus_stamp[BUS_FRAMES]; //sync_ms at the address byte
+extern volatile uint32_t sync_ms; //ms of the master, counted by ISR_low()
+extern volatile int16_t sync_trim; //tick shortening, 1/256 us per ms
+extern int16_t sync_acc, sync_err;
+extern int32_t sync_sum;
+extern uint8_t sync_lock;
+#endif
+extern uint8_t clock_level, clock_next;
+extern volatile uint8_t tick;
+extern volatile uint8_t rx_buf[RX_SIZE], rx_head;
+extern uint8_t rx_tail;
+extern volatile uint8_t tx_buf[TX_SIZE], tx_head, tx_tail;
+
+void OSCILLATOR_Initialize(void);
+void TIMER1_Initialize(void);
+void TIMER2_Initialize(void);
+void UART_Initialize(void);
+void FANOUT_Initialize(void);
+void fanout_set(uint8_t d, uint16_t half);
+void fanout_tick(void);
+void fanout_home(void);
+void unison_set(uint16_t half);
+void unison_phase(void);
+void BUS_Initialize(void);
+uint8_t crc8(uint8_t crc, uint8_t b);
+uint8_t bus_poll(void);
+void bus_queue(bus_event_t * e);
+uint16_t sync_now(void);
+void sync_beacon(uint32_t master, uint32_t stamp);
+void bus_play(void);
+void clock_set(uint8_t level);
+uint8_t clock_plan(uint16_t pos);
+void clock_ahead(uint16_t left);
+void putch(char c);
+void tx_put(uint8_t c);
+void put_str(const char * s);
+void put_nl(void);
+void put_uint(uint16_t v);
+void put_int(int16_t v);
+char read_char(void);
+void read_line(char * s, int max_len);
+void Beep(uint16_t frequency, uint16_t duration);
+void sleep(uint16_t ms);
+uint16_t drum_hit(uint16_t duration);
+void drum_set(uint16_t half);
+void wait_tick(void);
+void tick_reset(void);
+void idle(void);
+void play(void);
+uint8_t playback_tick(void);
+void console_poll(void);
+uint16_t scale_duration(uint16_t ms);
+void tempo_reset(void);
+void tempo_next(void);
+void score_save(score_state_t * s);
+void score_load(const score_state_t * s);
+void loop_back(void);
+uint16_t articulate(uint16_t ms);
+uint16_t transpose_frequency(uint16_t frequency);
+void control(uint16_t event, uint16_t arg);
+void voice_reset(void);
+void voice_start(uint16_t base, uint16_t frequency);
+void voice_tick(void);
+void voice_update(void);
+uint16_t period_at(uint16_t base, int16_t p);
+int16_t pitch_between(uint16_t from, uint16_t to);
+void __interrupt(high_priority) ISR(void);
+void __interrupt(low_priority) ISR_low(void);
+
+#include "debug.h"
+
+#ifndef CLOCK_SCALING
+#if defined(INSTRUMENT) || defined(TRACE)
+#define CLOCK_SCALING 0 //Timer3 and Timer0 must count at a fixed clock
+#elif FANOUT_DRIVES
+#define CLOCK_SCALING 0 //Timer4 and MSSP1 are set up for 64 MHz
+#elif BUS_ADDRESS
+#define CLOCK_SCALING 0 //so is the EUSART2 baud rate
+#else
+#define CLOCK_SCALING 1 //0 keeps the 64 MHz of OSCILLATOR_Initialize()
+#endif
+#endif
+
+#endif
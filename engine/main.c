@@ -0,0 +1,99 @@
+#include <xc.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "engine.h"
+
+#pragma config FOSC = INTIO67   // Oscillator Selection bits (Internal oscillator block)
+#pragma config PLLCFG = 0     // 4X PLL Enable (Oscillator used directly)
+#pragma config PRICLKEN = 1    // Primary clock enable bit (Primary clock enabled)
+#pragma config FCMEN = 0      // Fail-Safe Clock Monitor Enable bit (Fail-Safe Clock Monitor disabled)
+#pragma config IESO = 0       // Internal/External Oscillator Switchover bit (Oscillator Switchover mode disabled)
+
+// CONFIG2L
+#pragma config PWRTEN = 0     // Power-up Timer Enable bit (Power up timer disabled)
+#pragma config BOREN = SBORDIS  // Brown-out Reset Enable bits (Brown-out Reset enabled in hardware only (SBOREN is disabled))
+#pragma config BORV = 190       // Brown Out Reset Voltage bits (VBOR set to 1.90 V nominal)
+
+// CONFIG2H
+#pragma config WDTEN = 0       // Watchdog Timer Enable bits (WDT is always enabled. SWDTEN bit has no effect)
+#pragma config WDTPS = 32768    // Watchdog Timer Postscale Select bits (1:32768)
+
+void main(void) {
+    int f = 440, ms = 100;
+    char str[20];
+    OSCILLATOR_Initialize();
+    UART_Initialize();
+    put_str("\n\rRESET\n\r"); //debug
+    TIMER1_Initialize(); //tone generator timer
+    TIMER2_Initialize(); //note duration timebase
+    voice_reset();
+#if FANOUT_DRIVES
+    FANOUT_Initialize();
+#endif
+#if BUS_ADDRESS
+    BUS_Initialize();
+#endif
+#ifdef INSTRUMENT
+    INSTR_Initialize();
+#endif
+#ifdef TRACE
+    TRACE_Initialize();
+#endif
+    RCONbits.IPEN = 1; // two priority levels, see ISR() and ISR_low()
+    INTCONbits.GIEH = 1; // enable high priority interrupts, same bit as GIE
+    INTCONbits.GIEL = 1; // enable low priority interrupts, same bit as PEIE
+    ANSELAbits.ANSA0 = 0; //set RA0 as digital
+    ANSELAbits.ANSA1 = 0; //set RA1 as digital
+    TRISAbits.RA0 = 0; //RA0 as output
+    TRISAbits.RA1 = 0; //RA1 as output
+    LATAbits.LA1 = 0; //floppy dyrection
+    LATAbits.LA0 = 0; //floppy square wave
+#ifdef PROBE
+    ANSELBbits.ANSB0 = 0; //probe pins RB0..RB2 as digital outputs
+    ANSELBbits.ANSB1 = 0;
+    ANSELBbits.ANSB2 = 0;
+    LATB &= 0xF8;
+    TRISB &= 0xF8;
+#endif
+#if HOMING && FANOUT_DRIVES
+    fanout_home();
+    on = 1;
+#elif HOMING
+    Beep(698, 2714); //put head in 0 position
+    on = 1;
+    cnt = 0;
+    LATAbits.LA1 = ~LATAbits.LA1;
+    sleep(1714);
+#else
+    on = 1;
+#endif
+    put_str(SONG_TITLE "\n\r");
+#if BUS_ADDRESS
+    bus_play();
+#else
+    play();
+#endif
+    while (1) {
+        put_str("Digitare una frequenza intera: ");
+        read_line(str, 20);
+#ifdef INSTRUMENT
+        if (str[0] == 'i') {
+            stats_dump();
+            continue;
+        }
+#endif
+        if (str[0] == 'p') { //replay the song
+            play();
+            continue;
+        }
+#if BUS_ADDRESS
+        if (str[0] == 'l') { //listen to the bus again
+            bus_play();
+            continue;
+        }
+#endif
+        if (str[0] != 0) f = atoi(str);
+        Beep(f, ms);
+    }
+    return;
+}
@@ -0,0 +1,58 @@
+#include "engine.h"
+
+const note_t song[] = { //{frequency, ms}, 0 Hz is a rest
+    {391, 230},
+    {391, 230},
+    {440, 461},
+    {391, 461},
+    {523, 461},
+    {493, 923},
+    {391, 230},
+    {391, 230},
+    {440, 461},
+    {391, 461},
+    {587, 461},
+    {523, 923},
+    {391, 230},
+    {391, 230},
+    {783, 461},
+    {659, 461},
+    {523, 230},
+    {523, 230},
+    {493, 461},
+    {440, 461},
+    {698, 230},
+    {698, 230},
+    {659, 461},
+    {523, 461},
+    {587, 461},
+    {523, 923},
+    {391, 230},
+    {391, 230},
+    {440, 461},
+    {391, 461},
+    {523, 461},
+    {493, 923},
+    {391, 230},
+    {391, 230},
+    {440, 461},
+    {391, 461},
+    {587, 461},
+    {523, 923},
+    {391, 230},
+    {391, 230},
+    {783, 465},
+    {659, 465},
+    {523, 232},
+    {523, 232},
+    {493, 480},
+    {440, 480},
+    {698, 247},
+    {698, 247},
+    {659, 512},
+    {523, 512},
+    {587, 512},
+    {523, 1025},
+};
+
+const uint16_t song_length = sizeof (song) / sizeof (song[0]);
@@ -1,1217 +0,0 @@
-#include <xc.h>
-#include <stdio.h>
-#include <stdint.h>
-#include <math.h>
-#include <stdlib.h>
-
-#define _XTAL_FREQ 64000000
-
-#pragma config FOSC = INTIO67   // Oscillator Selection bits (Internal oscillator block)
-#pragma config PLLCFG = 0     // 4X PLL Enable (Oscillator used directly)
-#pragma config PRICLKEN = 1    // Primary clock enable bit (Primary clock enabled)
-#pragma config FCMEN = 0      // Fail-Safe Clock Monitor Enable bit (Fail-Safe Clock Monitor disabled)
-#pragma config IESO = 0       // Internal/External Oscillator Switchover bit (Oscillator Switchover mode disabled)
-
-// CONFIG2L
-#pragma config PWRTEN = 0     // Power-up Timer Enable bit (Power up timer disabled)
-#pragma config BOREN = SBORDIS  // Brown-out Reset Enable bits (Brown-out Reset enabled in hardware only (SBOREN is disabled))
-#pragma config BORV = 190       // Brown Out Reset Voltage bits (VBOR set to 1.90 V nominal)
-
-// CONFIG2H
-#pragma config WDTEN = 0       // Watchdog Timer Enable bits (WDT is always enabled. SWDTEN bit has no effect)
-#pragma config WDTPS = 32768    // Watchdog Timer Postscale Select bits (1:32768)
-
-void OSCILLATOR_Initialize(void);
-void TIMER1_Initialize(void);
-void UART_Initialize(void);
-void putch(char c);
-char read_char(void);
-void read_line(char * s, int max_len);
-void Beep(uint16_t frequency, uint16_t duration);
-void sleep(uint16_t ms);
-void peer_gynt_mountain_king(void);
-void __interrupt() ISR(void);
-
-uint16_t offset;
-uint8_t cnt = 0, on = 0;
-
-void main(void) {
-    int f, ms = 100;
-    char str[20];
-    OSCILLATOR_Initialize();
-    UART_Initialize();
-    printf("\n\rRESET\n\r"); //debug
-    TIMER1_Initialize(); //tone generator timer
-    INTCONbits.GIE = 1; // global enable interrupts
-    INTCONbits.PEIE = 1; // peripheral enable interrupts
-    ANSELAbits.ANSA0 = 0; //set RA0 as digital
-    ANSELAbits.ANSA1 = 0; //set RA1 as digital
-    TRISAbits.RA0 = 0; //RA0 as output
-    TRISAbits.RA1 = 0; //RA1 as output
-    LATAbits.LA1 = 0; //floppy dyrection
-    LATAbits.LA0 = 0; //floppy square wave
-    Beep(698, 2714); //put head in 0 position
-    on = 1;
-    cnt = 0;
-    LATAbits.LA1 = ~LATAbits.LA1;
-    sleep(1714);
-    printf("Peeg Gynt - In the hall of the mountain king.\n\r");
-    peer_gynt_mountain_king();
-    while (1) {
-        printf("Digitare una frequenza intera: ");
-        read_line(str, 20);
-        if (str[0] != 0) f = atoi(str);
-        Beep(f, ms);
-    }
-    return;
-}
-
-void OSCILLATOR_Initialize(void) {
-    // setup oscillator
-    OSCCONbits.SCS = 0b00; // primary clock determined by CONFIG1H
-    OSCCONbits.IRCF = 0b111; // 16 MHz internal oscillator
-    OSCTUNEbits.PLLEN = 1; // Enable PLL
-    while (OSCCONbits.HFIOFS == 0); // busy-wait until high frequency
-    // oscillator becomes stable
-    // now, using 16MHz + 4xPLL, we have an FOSC of 64 MHz
-}
-
-void TIMER1_Initialize(void) { //tone generator timer
-    T1CONbits.TMR1ON = 0; //stop the timer
-    T1CONbits.TMR1CS = 0; //Timer1 clock source is instruction clock (FOSC/4)
-    T1CONbits.T1RD16 = 1; //Enables register read/write of Timer1 in one 16-bit operation
-    T1CONbits.T1CKPS = 3; //1:8 Prescale value
-    TMR1 = 0x0000;
-    PIR1bits.TMR1IF = 0;
-    PIE1bits.TMR1IE = 1;
-}
-
-void UART_Initialize(void) {
-    ANSELA = 0;
-    ANSELC = 0;
-    // setup UART
-    TRISCbits.TRISC6 = 0; // TX
-    TRISCbits.TRISC7 = 1; // RX
-
-    TXSTA1bits.SYNC = 0;
-    TXSTA1bits.TX9 = 0;
-    TXSTA1bits.TXEN = 1;
-
-    RCSTA1bits.RX9 = 0;
-    RCSTA1bits.CREN = 1;
-    RCSTA1bits.SPEN = 1;
-
-    BAUDCON1bits.BRG16 = 0;
-    TXSTA1bits.BRGH = 0;
-    //SPBRG1 = 8; // 115200
-    SPBRG1 = 51; // 19200
-    SPBRGH1 = 0;
-}
-
-void putch(char c) {
-    // wait the end of transmission
-    while (TXSTA1bits.TRMT == 0) {
-    };
-    TXREG1 = c; // send the new byte
-}
-
-char read_char(void) {
-    while (PIR1bits.RC1IF == 0) {
-        if (RCSTA1bits.OERR == 1) {
-            RCSTA1bits.OERR = 0;
-            RCSTA1bits.CREN = 0;
-            RCSTA1bits.CREN = 1;
-        }
-    }
-    return RCREG1;
-}
-
-void read_line(char * s, int max_len) {
-    int i = 0;
-    for (;;) {
-        char c = read_char();
-        if (c == 13) {
-            putchar(c);
-            putchar(10);
-            s[i] = 0;
-            return;
-        } else if (c == 127 || c == 8) {
-            if (i > 0) {
-                putchar(c);
-                putchar(' ');
-                putchar(c);
-                --i;
-            }
-        } else if (c >= 32) {
-            if (i < max_len) {
-                putchar(c);
-                s[i] = c;
-                ++i;
-            }
-        }
-    }
-}
-
-void Beep(uint16_t frequency, uint16_t duration) {
-    int i;
-    frequency = (uint16_t)((double)frequency / 3.5);
-    offset = (uint16_t) ((double) 65535 - ((double) 1000000 / (double) frequency)); //load start timer value
-    TMR1 = offset;
-    T1CONbits.TMR1ON = 1; //start tone generator timer
-    for (i = 0; i < duration; i++) {
-        __delay_ms(1);
-    }
-    T1CONbits.TMR1ON = 0; //stop tone generator timer
-}
-
-void sleep(uint16_t ms) {
-    int i;
-    for (i = 0; i < ms; i++) {
-        __delay_ms(1);
-    }
-}
-
-void __interrupt() ISR(void) {
-    if (PIR1bits.TMR1IF) { //tone generator timer
-        TMR1 = offset;
-        cnt++;
-        LATAbits.LA0 = ~LATAbits.LA0;
-        PIR1bits.TMR1IF = 0;
-    }
-    if (cnt == 140 && on == 1) { //inversion counter
-        cnt = 0;
-        LATAbits.LA1 = ~LATAbits.LA1;
-    }
-}
-
-void peer_gynt_mountain_king() {
-    Beep(61, 106);
-	sleep(110);
-	Beep(69, 106);
-	sleep(110);
-	Beep(73, 106);
-	sleep(110);
-	Beep(82, 106);
-	sleep(110);
-	Beep(92, 106);
-	sleep(110);
-	Beep(73, 106);
-	sleep(110);
-	Beep(92, 213);
-	sleep(220);
-	Beep(87, 106);
-	sleep(110);
-	Beep(69, 106);
-	sleep(110);
-	Beep(87, 213);
-	sleep(220);
-	Beep(82, 106);
-	sleep(110);
-	Beep(65, 106);
-	sleep(110);
-	Beep(82, 213);
-	sleep(220);
-	Beep(61, 106);
-	sleep(110);
-	Beep(69, 106);
-	sleep(110);
-	Beep(73, 106);
-	sleep(110);
-	Beep(82, 106);
-	sleep(110);
-	Beep(92, 106);
-	sleep(110);
-	Beep(73, 106);
-	sleep(110);
-	Beep(92, 106);
-	sleep(110);
-	Beep(123, 106);
-	sleep(110);
-	Beep(110, 106);
-	sleep(110);
-	Beep(92, 106);
-	sleep(110);
-	Beep(73, 106);
-	sleep(110);
-	Beep(92, 106);
-	sleep(110);
-	Beep(110, 784);
-	sleep(84);
-	Beep(123, 106);
-	sleep(110);
-	Beep(138, 106);
-	sleep(110);
-	Beep(146, 106);
-	sleep(110);
-	Beep(164, 106);
-	sleep(110);
-	Beep(184, 106);
-	sleep(110);
-	Beep(146, 106);
-	sleep(110);
-	Beep(184, 213);
-	sleep(220);
-	Beep(174, 106);
-	sleep(110);
-	Beep(138, 106);
-	sleep(110);
-	Beep(174, 213);
-	sleep(220);
-	Beep(164, 106);
-	sleep(110);
-	Beep(130, 106);
-	sleep(110);
-	Beep(164, 213);
-	sleep(220);
-	Beep(123, 106);
-	sleep(110);
-	Beep(138, 106);
-	sleep(110);
-	Beep(146, 106);
-	sleep(110);
-	Beep(164, 106);
-	sleep(110);
-	Beep(184, 106);
-	sleep(110);
-	Beep(146, 106);
-	sleep(110);
-	Beep(184, 106);
-	sleep(110);
-	Beep(246, 106);
-	sleep(110);
-	Beep(220, 106);
-	sleep(110);
-	Beep(184, 106);
-	sleep(110);
-	Beep(146, 106);
-	sleep(110);
-	Beep(184, 106);
-	sleep(110);
-	Beep(220, 784);
-	sleep(84);
-	Beep(92, 106);
-	sleep(110);
-	Beep(103, 106);
-	sleep(110);
-	Beep(116, 106);
-	sleep(110);
-	Beep(123, 106);
-	sleep(110);
-	Beep(138, 106);
-	sleep(110);
-	Beep(116, 106);
-	sleep(110);
-	Beep(138, 213);
-	sleep(220);
-	Beep(146, 106);
-	sleep(110);
-	Beep(116, 106);
-	sleep(110);
-	Beep(146, 213);
-	sleep(220);
-	Beep(138, 106);
-	sleep(110);
-	Beep(116, 106);
-	sleep(110);
-	Beep(138, 213);
-	sleep(220);
-	Beep(92, 106);
-	sleep(110);
-	Beep(103, 106);
-	sleep(110);
-	Beep(116, 106);
-	sleep(110);
-	Beep(123, 106);
-	sleep(110);
-	Beep(138, 106);
-	sleep(110);
-	Beep(116, 106);
-	sleep(110);
-	Beep(138, 213);
-	sleep(220);
-	Beep(146, 106);
-	sleep(110);
-	Beep(116, 106);
-	sleep(110);
-	Beep(146, 213);
-	sleep(220);
-	Beep(138, 426);
-	sleep(443);
-	Beep(184, 106);
-	sleep(110);
-	Beep(207, 106);
-	sleep(110);
-	Beep(233, 106);
-	sleep(110);
-	Beep(246, 106);
-	sleep(110);
-	Beep(277, 106);
-	sleep(110);
-	Beep(233, 106);
-	sleep(110);
-	Beep(277, 213);
-	sleep(220);
-	Beep(293, 106);
-	sleep(110);
-	Beep(233, 106);
-	sleep(110);
-	Beep(293, 213);
-	sleep(220);
-	Beep(277, 106);
-	sleep(110);
-	Beep(233, 106);
-	sleep(110);
-	Beep(277, 213);
-	sleep(220);
-	Beep(184, 106);
-	sleep(110);
-	Beep(207, 106);
-	sleep(110);
-	Beep(233, 106);
-	sleep(110);
-	Beep(246, 106);
-	sleep(110);
-	Beep(277, 106);
-	sleep(110);
-	Beep(233, 106);
-	sleep(110);
-	Beep(277, 213);
-	sleep(220);
-	Beep(293, 106);
-	sleep(110);
-	Beep(233, 106);
-	sleep(110);
-	Beep(293, 213);
-	sleep(220);
-	Beep(277, 426);
-	sleep(443);
-	Beep(61, 103);
-	sleep(107);
-	Beep(69, 103);
-	sleep(107);
-	Beep(73, 103);
-	sleep(107);
-	Beep(82, 103);
-	sleep(107);
-	Beep(92, 103);
-	sleep(107);
-	Beep(73, 103);
-	sleep(107);
-	Beep(92, 207);
-	sleep(214);
-	Beep(87, 103);
-	sleep(107);
-	Beep(69, 103);
-	sleep(107);
-	Beep(87, 207);
-	sleep(214);
-	Beep(82, 103);
-	sleep(107);
-	Beep(65, 103);
-	sleep(107);
-	Beep(82, 207);
-	sleep(214);
-	Beep(61, 103);
-	sleep(107);
-	Beep(69, 103);
-	sleep(107);
-	Beep(73, 103);
-	sleep(107);
-	Beep(82, 103);
-	sleep(107);
-	Beep(92, 103);
-	sleep(107);
-	Beep(73, 103);
-	sleep(107);
-	Beep(92, 103);
-	sleep(107);
-	Beep(123, 103);
-	sleep(107);
-	Beep(110, 103);
-	sleep(107);
-	Beep(92, 103);
-	sleep(107);
-	Beep(73, 103);
-	sleep(107);
-	Beep(92, 103);
-	sleep(107);
-	Beep(110, 762);
-	sleep(82);
-	Beep(123, 103);
-	sleep(107);
-	Beep(138, 103);
-	sleep(107);
-	Beep(146, 103);
-	sleep(107);
-	Beep(164, 103);
-	sleep(107);
-	Beep(184, 103);
-	sleep(107);
-	Beep(146, 103);
-	sleep(107);
-	Beep(184, 207);
-	sleep(214);
-	Beep(174, 103);
-	sleep(107);
-	Beep(138, 103);
-	sleep(107);
-	Beep(174, 207);
-	sleep(214);
-	Beep(164, 103);
-	sleep(107);
-	Beep(130, 103);
-	sleep(107);
-	Beep(164, 207);
-	sleep(214);
-	Beep(123, 103);
-	sleep(107);
-	Beep(138, 103);
-	sleep(107);
-	Beep(146, 103);
-	sleep(107);
-	Beep(164, 103);
-	sleep(107);
-	Beep(184, 103);
-	sleep(107);
-	Beep(146, 103);
-	sleep(107);
-	Beep(184, 103);
-	sleep(107);
-	Beep(246, 103);
-	sleep(107);
-	Beep(184, 103);
-	sleep(107);
-	Beep(146, 103);
-	sleep(107);
-	Beep(184, 103);
-	sleep(107);
-	Beep(246, 103);
-	sleep(107);
-	Beep(123, 762);
-	sleep(82);
-	Beep(246, 103);
-	sleep(107);
-	Beep(277, 103);
-	sleep(107);
-	Beep(293, 103);
-	sleep(107);
-	Beep(329, 103);
-	sleep(107);
-	Beep(369, 103);
-	sleep(107);
-	Beep(293, 103);
-	sleep(107);
-	Beep(369, 207);
-	sleep(214);
-	Beep(349, 103);
-	sleep(107);
-	Beep(277, 103);
-	sleep(107);
-	Beep(349, 207);
-	sleep(214);
-	Beep(329, 103);
-	sleep(107);
-	Beep(261, 103);
-	sleep(107);
-	Beep(329, 207);
-	sleep(214);
-	Beep(246, 103);
-	sleep(107);
-	Beep(277, 103);
-	sleep(107);
-	Beep(293, 103);
-	sleep(107);
-	Beep(329, 103);
-	sleep(107);
-	Beep(369, 103);
-	sleep(107);
-	Beep(293, 103);
-	sleep(107);
-	Beep(369, 103);
-	sleep(107);
-	Beep(493, 103);
-	sleep(107);
-	Beep(440, 103);
-	sleep(107);
-	Beep(369, 103);
-	sleep(107);
-	Beep(293, 103);
-	sleep(107);
-	Beep(369, 103);
-	sleep(107);
-	Beep(440, 762);
-	sleep(82);
-	Beep(493, 103);
-	sleep(107);
-	Beep(554, 103);
-	sleep(107);
-	Beep(587, 103);
-	sleep(107);
-	Beep(659, 103);
-	sleep(107);
-	Beep(739, 103);
-	sleep(107);
-	Beep(587, 103);
-	sleep(107);
-	Beep(739, 207);
-	sleep(214);
-	Beep(698, 103);
-	sleep(107);
-	Beep(554, 103);
-	sleep(107);
-	Beep(698, 207);
-	sleep(214);
-	Beep(659, 103);
-	sleep(107);
-	Beep(523, 103);
-	sleep(107);
-	Beep(659, 207);
-	sleep(214);
-	Beep(493, 103);
-	sleep(107);
-	Beep(554, 103);
-	sleep(107);
-	Beep(587, 103);
-	sleep(107);
-	Beep(659, 103);
-	sleep(107);
-	Beep(739, 103);
-	sleep(107);
-	Beep(587, 103);
-	sleep(107);
-	Beep(739, 103);
-	sleep(107);
-	Beep(987, 103);
-	sleep(107);
-	Beep(880, 103);
-	sleep(107);
-	Beep(739, 103);
-	sleep(107);
-	Beep(587, 103);
-	sleep(107);
-	Beep(739, 103);
-	sleep(107);
-	Beep(880, 762);
-	sleep(82);
-	Beep(369, 103);
-	sleep(107);
-	Beep(415, 103);
-	sleep(107);
-	Beep(466, 103);
-	sleep(107);
-	Beep(493, 103);
-	sleep(107);
-	Beep(554, 103);
-	sleep(107);
-	Beep(466, 103);
-	sleep(107);
-	Beep(554, 207);
-	sleep(214);
-	Beep(587, 103);
-	sleep(107);
-	Beep(466, 103);
-	sleep(107);
-	Beep(587, 207);
-	sleep(214);
-	Beep(554, 103);
-	sleep(107);
-	Beep(466, 103);
-	sleep(107);
-	Beep(554, 207);
-	sleep(214);
-	Beep(369, 103);
-	sleep(107);
-	Beep(415, 103);
-	sleep(107);
-	Beep(466, 103);
-	sleep(107);
-	Beep(493, 103);
-	sleep(107);
-	Beep(554, 103);
-	sleep(107);
-	Beep(466, 103);
-	sleep(107);
-	Beep(554, 207);
-	sleep(214);
-	Beep(587, 103);
-	sleep(107);
-	Beep(466, 103);
-	sleep(107);
-	Beep(587, 207);
-	sleep(214);
-	Beep(554, 414);
-	sleep(8);
-	Beep(466, 381);
-	sleep(41);
-	Beep(739, 103);
-	sleep(107);
-	Beep(830, 103);
-	sleep(107);
-	Beep(932, 103);
-	sleep(107);
-	Beep(987, 103);
-	sleep(107);
-	Beep(1108, 103);
-	sleep(107);
-	Beep(932, 103);
-	sleep(107);
-	Beep(1108, 207);
-	sleep(214);
-	Beep(1174, 103);
-	sleep(107);
-	Beep(932, 103);
-	sleep(107);
-	Beep(1174, 207);
-	sleep(214);
-	Beep(1108, 103);
-	sleep(107);
-	Beep(932, 103);
-	sleep(107);
-	Beep(1108, 207);
-	sleep(214);
-	Beep(739, 103);
-	sleep(107);
-	Beep(830, 103);
-	sleep(107);
-	Beep(932, 103);
-	sleep(107);
-	Beep(987, 103);
-	sleep(107);
-	Beep(1108, 103);
-	sleep(107);
-	Beep(932, 103);
-	sleep(107);
-	Beep(1108, 207);
-	sleep(214);
-	Beep(1174, 103);
-	sleep(107);
-	Beep(932, 103);
-	sleep(107);
-	Beep(1174, 207);
-	sleep(214);
-	Beep(1108, 414);
-	sleep(8);
-	Beep(932, 381);
-	sleep(41);
-	Beep(246, 101);
-	sleep(105);
-	Beep(277, 101);
-	sleep(105);
-	Beep(293, 101);
-	sleep(105);
-	Beep(329, 101);
-	sleep(105);
-	Beep(369, 101);
-	sleep(105);
-	Beep(293, 101);
-	sleep(105);
-	Beep(369, 203);
-	sleep(210);
-	Beep(349, 101);
-	sleep(105);
-	Beep(277, 101);
-	sleep(105);
-	Beep(349, 203);
-	sleep(210);
-	Beep(329, 101);
-	sleep(105);
-	Beep(261, 101);
-	sleep(105);
-	Beep(329, 203);
-	sleep(210);
-	Beep(246, 101);
-	sleep(105);
-	Beep(277, 101);
-	sleep(105);
-	Beep(293, 101);
-	sleep(105);
-	Beep(329, 101);
-	sleep(105);
-	Beep(369, 101);
-	sleep(105);
-	Beep(293, 101);
-	sleep(105);
-	Beep(369, 101);
-	sleep(105);
-	Beep(493, 101);
-	sleep(105);
-	Beep(440, 101);
-	sleep(105);
-	Beep(369, 101);
-	sleep(105);
-	Beep(293, 101);
-	sleep(105);
-	Beep(369, 101);
-	sleep(105);
-	Beep(440, 787);
-	sleep(40);
-	Beep(493, 99);
-	sleep(102);
-	Beep(554, 99);
-	sleep(102);
-	Beep(587, 99);
-	sleep(102);
-	Beep(659, 99);
-	sleep(102);
-	Beep(739, 99);
-	sleep(102);
-	Beep(587, 99);
-	sleep(102);
-	Beep(739, 199);
-	sleep(205);
-	Beep(698, 99);
-	sleep(102);
-	Beep(554, 99);
-	sleep(102);
-	Beep(698, 199);
-	sleep(205);
-	Beep(659, 99);
-	sleep(102);
-	Beep(523, 99);
-	sleep(102);
-	Beep(659, 199);
-	sleep(205);
-	Beep(493, 98);
-	sleep(101);
-	Beep(554, 96);
-	sleep(99);
-	Beep(587, 94);
-	sleep(97);
-	Beep(659, 92);
-	sleep(95);
-	Beep(739, 90);
-	sleep(93);
-	Beep(587, 88);
-	sleep(91);
-	Beep(739, 87);
-	sleep(90);
-	Beep(987, 85);
-	sleep(88);
-	Beep(739, 83);
-	sleep(86);
-	Beep(587, 82);
-	sleep(85);
-	Beep(739, 80);
-	sleep(83);
-	Beep(987, 79);
-	sleep(81);
-	Beep(493, 569);
-	sleep(61);
-	Beep(987, 77);
-	sleep(80);
-	Beep(1108, 77);
-	sleep(80);
-	Beep(1174, 77);
-	sleep(80);
-	Beep(1318, 77);
-	sleep(80);
-	Beep(1479, 77);
-	sleep(80);
-	Beep(1174, 77);
-	sleep(80);
-	Beep(1479, 155);
-	sleep(160);
-	Beep(1396, 77);
-	sleep(80);
-	Beep(1108, 77);
-	sleep(80);
-	Beep(1396, 155);
-	sleep(160);
-	Beep(1318, 77);
-	sleep(80);
-	Beep(1046, 77);
-	sleep(80);
-	Beep(1318, 155);
-	sleep(160);
-	Beep(987, 77);
-	sleep(80);
-	Beep(1108, 77);
-	sleep(80);
-	Beep(1174, 77);
-	sleep(80);
-	Beep(1318, 77);
-	sleep(80);
-	Beep(1479, 77);
-	sleep(80);
-	Beep(1174, 77);
-	sleep(80);
-	Beep(1479, 77);
-	sleep(80);
-	Beep(1975, 77);
-	sleep(80);
-	Beep(1760, 77);
-	sleep(80);
-	Beep(1479, 77);
-	sleep(80);
-	Beep(1174, 77);
-	sleep(80);
-	Beep(1479, 77);
-	sleep(80);
-	Beep(1760, 569);
-	sleep(61);
-	Beep(987, 77);
-	sleep(80);
-	Beep(1108, 77);
-	sleep(80);
-	Beep(1174, 77);
-	sleep(80);
-	Beep(1318, 77);
-	sleep(80);
-	Beep(1479, 77);
-	sleep(80);
-	Beep(1174, 77);
-	sleep(80);
-	Beep(1479, 155);
-	sleep(160);
-	Beep(1396, 77);
-	sleep(80);
-	Beep(1108, 77);
-	sleep(80);
-	Beep(1396, 155);
-	sleep(160);
-	Beep(1318, 77);
-	sleep(80);
-	Beep(1046, 77);
-	sleep(80);
-	Beep(1318, 155);
-	sleep(160);
-	Beep(987, 77);
-	sleep(80);
-	Beep(1108, 77);
-	sleep(80);
-	Beep(1174, 77);
-	sleep(80);
-	Beep(1318, 77);
-	sleep(80);
-	Beep(1479, 77);
-	sleep(80);
-	Beep(1174, 77);
-	sleep(80);
-	Beep(1479, 77);
-	sleep(80);
-	Beep(1975, 77);
-	sleep(80);
-	Beep(1760, 77);
-	sleep(80);
-	Beep(1479, 77);
-	sleep(80);
-	Beep(1174, 77);
-	sleep(80);
-	Beep(1479, 77);
-	sleep(80);
-	Beep(1760, 569);
-	sleep(61);
-	Beep(1479, 77);
-	sleep(80);
-	Beep(1661, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(1975, 77);
-	sleep(80);
-	Beep(2217, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(2217, 155);
-	sleep(160);
-	Beep(2349, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(2349, 155);
-	sleep(160);
-	Beep(2217, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(2217, 155);
-	sleep(160);
-	Beep(1479, 77);
-	sleep(79);
-	Beep(1661, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(1975, 77);
-	sleep(80);
-	Beep(2217, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(2217, 155);
-	sleep(160);
-	Beep(2349, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(2349, 155);
-	sleep(160);
-	Beep(2217, 309);
-	sleep(321);
-	Beep(1479, 77);
-	sleep(80);
-	Beep(1661, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(1975, 77);
-	sleep(80);
-	Beep(2217, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(2217, 155);
-	sleep(160);
-	Beep(2489, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(2489, 155);
-	sleep(160);
-	Beep(2217, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(2217, 155);
-	sleep(160);
-	Beep(1479, 77);
-	sleep(79);
-	Beep(1661, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(1975, 77);
-	sleep(80);
-	Beep(2217, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(2217, 155);
-	sleep(160);
-	Beep(2489, 77);
-	sleep(80);
-	Beep(1864, 77);
-	sleep(80);
-	Beep(2489, 155);
-	sleep(160);
-	Beep(2217, 309);
-	sleep(321);
-	Beep(987, 73);
-	sleep(76);
-	Beep(1108, 73);
-	sleep(76);
-	Beep(1174, 73);
-	sleep(76);
-	Beep(1318, 73);
-	sleep(76);
-	Beep(1479, 73);
-	sleep(76);
-	Beep(1174, 73);
-	sleep(76);
-	Beep(1479, 147);
-	sleep(152);
-	Beep(1396, 73);
-	sleep(76);
-	Beep(1108, 73);
-	sleep(76);
-	Beep(1396, 147);
-	sleep(152);
-	Beep(1318, 73);
-	sleep(76);
-	Beep(1046, 73);
-	sleep(76);
-	Beep(1318, 147);
-	sleep(152);
-	Beep(987, 73);
-	sleep(76);
-	Beep(1108, 73);
-	sleep(76);
-	Beep(1174, 73);
-	sleep(76);
-	Beep(1318, 73);
-	sleep(76);
-	Beep(1479, 73);
-	sleep(76);
-	Beep(1174, 73);
-	sleep(76);
-	Beep(1479, 73);
-	sleep(76);
-	Beep(1975, 73);
-	sleep(76);
-	Beep(1760, 73);
-	sleep(76);
-	Beep(1479, 73);
-	sleep(76);
-	Beep(1174, 73);
-	sleep(76);
-	Beep(1479, 73);
-	sleep(76);
-	Beep(1760, 541);
-	sleep(58);
-	Beep(987, 72);
-	sleep(73);
-	Beep(1108, 72);
-	sleep(74);
-	Beep(1174, 72);
-	sleep(74);
-	Beep(1318, 72);
-	sleep(74);
-	Beep(1479, 72);
-	sleep(74);
-	Beep(1174, 72);
-	sleep(74);
-	Beep(1479, 144);
-	sleep(148);
-	Beep(1396, 72);
-	sleep(74);
-	Beep(1108, 72);
-	sleep(74);
-	Beep(1396, 144);
-	sleep(148);
-	Beep(1318, 72);
-	sleep(74);
-	Beep(1046, 72);
-	sleep(74);
-	Beep(1318, 144);
-	sleep(148);
-	Beep(987, 72);
-	sleep(73);
-	Beep(1108, 72);
-	sleep(74);
-	Beep(1174, 72);
-	sleep(74);
-	Beep(1318, 72);
-	sleep(74);
-	Beep(1479, 70);
-	sleep(72);
-	Beep(1174, 70);
-	sleep(72);
-	Beep(1479, 68);
-	sleep(70);
-	Beep(1975, 68);
-	sleep(70);
-	Beep(1479, 67);
-	sleep(69);
-	Beep(1174, 67);
-	sleep(69);
-	Beep(1479, 67);
-	sleep(69);
-	Beep(1975, 67);
-	sleep(69);
-	Beep(987, 492);
-	sleep(132);
-	Beep(1661, 41);
-	Beep(1760, 69);
-	Beep(1864, 40);
-	Beep(1975, 208);
-	sleep(563);
-	Beep(1661, 41);
-	Beep(1760, 69);
-	Beep(1864, 40);
-	Beep(1975, 208);
-	sleep(484);
-	Beep(493, 56);
-	sleep(58);
-	Beep(554, 56);
-	sleep(58);
-	Beep(587, 56);
-	sleep(58);
-	Beep(659, 56);
-	sleep(58);
-	Beep(739, 56);
-	sleep(58);
-	Beep(587, 56);
-	sleep(58);
-	Beep(739, 56);
-	sleep(58);
-	Beep(987, 56);
-	sleep(58);
-	Beep(932, 56);
-	sleep(58);
-	Beep(739, 56);
-	sleep(58);
-	Beep(932, 56);
-	sleep(58);
-	Beep(1108, 56);
-	sleep(58);
-	Beep(987, 416);
-	sleep(124);
-	Beep(1661, 41);
-	Beep(1760, 69);
-	Beep(1864, 40);
-	Beep(1975, 208);
-	sleep(563);
-	Beep(1661, 41);
-	Beep(1760, 69);
-	Beep(1864, 40);
-	Beep(1975, 208);
-	sleep(484);
-	Beep(987, 56);
-	sleep(58);
-	Beep(1108, 56);
-	sleep(58);
-	Beep(1174, 56);
-	sleep(58);
-	Beep(1318, 56);
-	sleep(58);
-	Beep(1479, 56);
-	sleep(58);
-	Beep(1174, 56);
-	sleep(58);
-	Beep(1479, 56);
-	sleep(58);
-	Beep(1975, 56);
-	sleep(58);
-	Beep(1864, 56);
-	sleep(58);
-	Beep(1479, 56);
-	sleep(58);
-	Beep(1864, 56);
-	sleep(58);
-	Beep(2217, 56);
-	sleep(58);
-	Beep(1975, 416);
-	sleep(124);
-	Beep(1661, 41);
-	Beep(1760, 69);
-	Beep(1864, 40);
-	Beep(1975, 208);
-	sleep(563);
-	Beep(1661, 41);
-	Beep(1760, 69);
-	Beep(1864, 40);
-	Beep(1975, 208);
-	sleep(563);
-	Beep(1661, 41);
-	Beep(1760, 69);
-	Beep(1864, 40);
-	sleep(55);
-	Beep(1661, 64);
-	Beep(1760, 69);
-	Beep(1864, 40);
-	sleep(55);
-	Beep(1661, 64);
-	Beep(1760, 69);
-	Beep(1864, 40);
-	Beep(1975, 208);
-	sleep(22);
-	Beep(1661, 41);
-	Beep(1760, 69);
-	Beep(1864, 40);
-	Beep(1975, 56);
-	sleep(78);
-	Beep(1661, 64);
-	Beep(1760, 69);
-	Beep(1864, 40);
-	sleep(55);
-	Beep(1661, 64);
-	Beep(1760, 69);
-	Beep(1864, 40);
-	Beep(1975, 208);
-	sleep(1948);
-	Beep(1661, 41);
-	Beep(1760, 69);
-	Beep(1864, 40);
-	Beep(1975, 208);
-}
\ No newline at end of file
@@ -0,0 +1,1046 @@
+#include "engine.h"
+
+const note_t song[] = { //{frequency, ms}, 0 Hz is a rest
+    {61, 106},
+    {0, 110},
+    {69, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {82, 106},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {92, 213},
+    {0, 220},
+    {87, 106},
+    {0, 110},
+    {69, 106},
+    {0, 110},
+    {87, 213},
+    {0, 220},
+    {82, 106},
+    {0, 110},
+    {65, 106},
+    {0, 110},
+    {82, 213},
+    {0, 220},
+    {61, 106},
+    {0, 110},
+    {69, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {82, 106},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {123, 106},
+    {0, 110},
+    {110, 106},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {110, 784},
+    {0, 84},
+    {123, 106},
+    {0, 110},
+    {138, 106},
+    {0, 110},
+    {146, 106},
+    {0, 110},
+    {164, 106},
+    {0, 110},
+    {184, 106},
+    {0, 110},
+    {146, 106},
+    {0, 110},
+    {184, 213},
+    {0, 220},
+    {174, 106},
+    {0, 110},
+    {138, 106},
+    {0, 110},
+    {174, 213},
+    {0, 220},
+    {164, 106},
+    {0, 110},
+    {130, 106},
+    {0, 110},
+    {164, 213},
+    {0, 220},
+    {123, 106},
+    {0, 110},
+    {138, 106},
+    {0, 110},
+    {146, 106},
+    {0, 110},
+    {164, 106},
+    {0, 110},
+    {184, 106},
+    {0, 110},
+    {146, 106},
+    {0, 110},
+    {184, 106},
+    {0, 110},
+    {246, 106},
+    {0, 110},
+    {220, 106},
+    {0, 110},
+    {184, 106},
+    {0, 110},
+    {146, 106},
+    {0, 110},
+    {184, 106},
+    {0, 110},
+    {220, 784},
+    {0, 84},
+    {92, 106},
+    {0, 110},
+    {103, 106},
+    {0, 110},
+    {116, 106},
+    {0, 110},
+    {123, 106},
+    {0, 110},
+    {138, 106},
+    {0, 110},
+    {116, 106},
+    {0, 110},
+    {138, 213},
+    {0, 220},
+    {146, 106},
+    {0, 110},
+    {116, 106},
+    {0, 110},
+    {146, 213},
+    {0, 220},
+    {138, 106},
+    {0, 110},
+    {116, 106},
+    {0, 110},
+    {138, 213},
+    {0, 220},
+    {92, 106},
+    {0, 110},
+    {103, 106},
+    {0, 110},
+    {116, 106},
+    {0, 110},
+    {123, 106},
+    {0, 110},
+    {138, 106},
+    {0, 110},
+    {116, 106},
+    {0, 110},
+    {138, 213},
+    {0, 220},
+    {146, 106},
+    {0, 110},
+    {116, 106},
+    {0, 110},
+    {146, 213},
+    {0, 220},
+    {138, 426},
+    {0, 443},
+    {184, 106},
+    {0, 110},
+    {207, 106},
+    {0, 110},
+    {233, 106},
+    {0, 110},
+    {246, 106},
+    {0, 110},
+    {277, 106},
+    {0, 110},
+    {233, 106},
+    {0, 110},
+    {277, 213},
+    {0, 220},
+    {293, 106},
+    {0, 110},
+    {233, 106},
+    {0, 110},
+    {293, 213},
+    {0, 220},
+    {277, 106},
+    {0, 110},
+    {233, 106},
+    {0, 110},
+    {277, 213},
+    {0, 220},
+    {184, 106},
+    {0, 110},
+    {207, 106},
+    {0, 110},
+    {233, 106},
+    {0, 110},
+    {246, 106},
+    {0, 110},
+    {277, 106},
+    {0, 110},
+    {233, 106},
+    {0, 110},
+    {277, 213},
+    {0, 220},
+    {293, 106},
+    {0, 110},
+    {233, 106},
+    {0, 110},
+    {293, 213},
+    {0, 220},
+    {277, 426},
+    {0, 443},
+    {EV_TEMPO, 249},
+    {61, 106},
+    {0, 110},
+    {69, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {82, 106},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {92, 213},
+    {0, 220},
+    {87, 106},
+    {0, 110},
+    {69, 106},
+    {0, 110},
+    {87, 213},
+    {0, 220},
+    {82, 106},
+    {0, 110},
+    {65, 106},
+    {0, 110},
+    {82, 213},
+    {0, 221},
+    {61, 106},
+    {0, 111},
+    {69, 106},
+    {0, 111},
+    {73, 106},
+    {0, 111},
+    {82, 106},
+    {0, 111},
+    {92, 106},
+    {0, 111},
+    {73, 106},
+    {0, 111},
+    {92, 106},
+    {0, 111},
+    {123, 106},
+    {0, 111},
+    {110, 106},
+    {0, 111},
+    {92, 106},
+    {0, 111},
+    {73, 106},
+    {0, 111},
+    {92, 106},
+    {0, 111},
+    {110, 784},
+    {0, 85},
+    {123, 106},
+    {0, 111},
+    {138, 106},
+    {0, 111},
+    {146, 106},
+    {0, 111},
+    {164, 106},
+    {0, 111},
+    {184, 106},
+    {0, 111},
+    {146, 106},
+    {0, 111},
+    {184, 213},
+    {0, 221},
+    {174, 106},
+    {0, 111},
+    {138, 106},
+    {0, 111},
+    {174, 213},
+    {0, 221},
+    {164, 106},
+    {0, 111},
+    {130, 106},
+    {0, 111},
+    {164, 213},
+    {0, 221},
+    {123, 106},
+    {0, 111},
+    {138, 106},
+    {0, 111},
+    {146, 106},
+    {0, 111},
+    {164, 106},
+    {0, 111},
+    {184, 106},
+    {0, 111},
+    {146, 106},
+    {0, 111},
+    {184, 106},
+    {0, 111},
+    {246, 106},
+    {0, 111},
+    {184, 106},
+    {0, 111},
+    {146, 106},
+    {0, 111},
+    {184, 106},
+    {0, 111},
+    {246, 106},
+    {0, 111},
+    {123, 784},
+    {0, 85},
+    {246, 106},
+    {0, 111},
+    {277, 106},
+    {0, 111},
+    {293, 106},
+    {0, 111},
+    {329, 106},
+    {0, 111},
+    {369, 106},
+    {0, 111},
+    {293, 106},
+    {0, 111},
+    {369, 213},
+    {0, 221},
+    {349, 106},
+    {0, 111},
+    {277, 106},
+    {0, 111},
+    {349, 213},
+    {0, 221},
+    {329, 106},
+    {0, 111},
+    {261, 106},
+    {0, 111},
+    {329, 213},
+    {0, 221},
+    {246, 106},
+    {0, 111},
+    {277, 106},
+    {0, 111},
+    {293, 106},
+    {0, 111},
+    {329, 106},
+    {0, 111},
+    {369, 106},
+    {0, 111},
+    {293, 106},
+    {0, 111},
+    {369, 106},
+    {0, 111},
+    {493, 106},
+    {0, 111},
+    {440, 106},
+    {0, 111},
+    {369, 106},
+    {0, 111},
+    {293, 106},
+    {0, 111},
+    {369, 106},
+    {0, 111},
+    {440, 784},
+    {0, 85},
+    {493, 106},
+    {0, 111},
+    {554, 106},
+    {0, 111},
+    {587, 106},
+    {0, 111},
+    {659, 106},
+    {0, 111},
+    {739, 106},
+    {0, 111},
+    {587, 106},
+    {0, 111},
+    {739, 213},
+    {0, 221},
+    {698, 106},
+    {0, 111},
+    {554, 106},
+    {0, 111},
+    {698, 213},
+    {0, 221},
+    {659, 106},
+    {0, 111},
+    {523, 106},
+    {0, 111},
+    {659, 213},
+    {0, 221},
+    {493, 106},
+    {0, 111},
+    {554, 106},
+    {0, 111},
+    {587, 106},
+    {0, 111},
+    {659, 106},
+    {0, 111},
+    {739, 106},
+    {0, 111},
+    {587, 106},
+    {0, 111},
+    {739, 106},
+    {0, 111},
+    {987, 106},
+    {0, 111},
+    {880, 106},
+    {0, 111},
+    {739, 106},
+    {0, 111},
+    {587, 106},
+    {0, 111},
+    {739, 106},
+    {0, 111},
+    {880, 784},
+    {0, 85},
+    {369, 106},
+    {0, 111},
+    {415, 106},
+    {0, 111},
+    {466, 106},
+    {0, 111},
+    {493, 106},
+    {0, 111},
+    {554, 106},
+    {0, 111},
+    {466, 106},
+    {0, 111},
+    {554, 213},
+    {0, 221},
+    {587, 106},
+    {0, 111},
+    {466, 106},
+    {0, 111},
+    {587, 213},
+    {0, 221},
+    {554, 106},
+    {0, 111},
+    {466, 106},
+    {0, 111},
+    {554, 213},
+    {0, 221},
+    {369, 106},
+    {0, 111},
+    {415, 106},
+    {0, 111},
+    {466, 106},
+    {0, 111},
+    {493, 106},
+    {0, 111},
+    {554, 106},
+    {0, 111},
+    {466, 106},
+    {0, 111},
+    {554, 213},
+    {0, 221},
+    {587, 106},
+    {0, 111},
+    {466, 106},
+    {0, 111},
+    {587, 213},
+    {0, 221},
+    {554, 426},
+    {0, 9},
+    {466, 392},
+    {0, 43},
+    {739, 106},
+    {0, 111},
+    {830, 106},
+    {0, 111},
+    {932, 106},
+    {0, 111},
+    {987, 106},
+    {0, 111},
+    {1108, 106},
+    {0, 111},
+    {932, 106},
+    {0, 111},
+    {1108, 213},
+    {0, 221},
+    {1174, 106},
+    {0, 111},
+    {932, 106},
+    {0, 111},
+    {1174, 213},
+    {0, 221},
+    {1108, 106},
+    {0, 111},
+    {932, 106},
+    {0, 111},
+    {1108, 213},
+    {0, 221},
+    {739, 106},
+    {0, 111},
+    {830, 106},
+    {0, 111},
+    {932, 106},
+    {0, 111},
+    {987, 106},
+    {0, 111},
+    {1108, 106},
+    {0, 111},
+    {932, 106},
+    {0, 111},
+    {1108, 213},
+    {0, 221},
+    {1174, 106},
+    {0, 111},
+    {932, 106},
+    {0, 111},
+    {1174, 213},
+    {0, 221},
+    {1108, 426},
+    {0, 9},
+    {932, 392},
+    {0, 43},
+    {EV_TEMPO, 244},
+    {246, 106},
+    {0, 111},
+    {277, 106},
+    {0, 111},
+    {293, 106},
+    {0, 111},
+    {329, 106},
+    {0, 111},
+    {369, 106},
+    {0, 111},
+    {293, 106},
+    {0, 111},
+    {369, 213},
+    {0, 221},
+    {349, 106},
+    {0, 111},
+    {277, 106},
+    {0, 111},
+    {349, 213},
+    {0, 221},
+    {329, 106},
+    {0, 111},
+    {261, 106},
+    {0, 111},
+    {329, 213},
+    {0, 221},
+    {246, 106},
+    {0, 111},
+    {277, 106},
+    {0, 111},
+    {293, 106},
+    {0, 111},
+    {329, 106},
+    {0, 111},
+    {369, 106},
+    {0, 111},
+    {293, 106},
+    {0, 111},
+    {369, 106},
+    {0, 111},
+    {493, 106},
+    {0, 111},
+    {440, 106},
+    {0, 111},
+    {369, 106},
+    {0, 111},
+    {293, 106},
+    {0, 111},
+    {369, 106},
+    {0, 111},
+    {440, 826},
+    {0, 42},
+    {EV_TEMPO, 238},
+    {493, 110},
+    {0, 110},
+    {554, 106},
+    {0, 110},
+    {587, 106},
+    {0, 110},
+    {659, 106},
+    {0, 110},
+    {739, 110},
+    {0, 110},
+    {587, 106},
+    {0, 110},
+    {739, 213},
+    {0, 220},
+    {698, 110},
+    {0, 110},
+    {554, 106},
+    {0, 110},
+    {698, 213},
+    {0, 220},
+    {659, 110},
+    {0, 110},
+    {523, 106},
+    {0, 110},
+    {659, 213},
+    {0, 220},
+    {EV_TEMPO, 236},
+    {EV_TEMPO_RAMP, 25},
+    {EV_TEMPO, 187},
+    {493, 110},
+    {0, 110},
+    {554, 110},
+    {0, 110},
+    {587, 110},
+    {0, 110},
+    {659, 106},
+    {0, 110},
+    {739, 106},
+    {0, 111},
+    {587, 106},
+    {0, 110},
+    {739, 110},
+    {0, 110},
+    {987, 106},
+    {0, 110},
+    {739, 106},
+    {0, 110},
+    {587, 110},
+    {0, 110},
+    {739, 106},
+    {0, 110},
+    {987, 106},
+    {0, 110},
+    {493, 779},
+    {0, 84},
+    {987, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1318, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 213},
+    {0, 220},
+    {1396, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1396, 213},
+    {0, 220},
+    {1318, 106},
+    {0, 110},
+    {1046, 106},
+    {0, 110},
+    {1318, 213},
+    {0, 220},
+    {987, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1318, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1975, 106},
+    {0, 110},
+    {1760, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1760, 779},
+    {0, 84},
+    {987, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1318, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 213},
+    {0, 220},
+    {1396, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1396, 213},
+    {0, 220},
+    {1318, 106},
+    {0, 110},
+    {1046, 106},
+    {0, 110},
+    {1318, 213},
+    {0, 220},
+    {987, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1318, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1975, 106},
+    {0, 110},
+    {1760, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1760, 779},
+    {0, 84},
+    {1479, 106},
+    {0, 110},
+    {1661, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {1975, 106},
+    {0, 110},
+    {2217, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {2217, 213},
+    {0, 220},
+    {2349, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {2349, 213},
+    {0, 220},
+    {2217, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {2217, 213},
+    {0, 220},
+    {1479, 106},
+    {0, 110},
+    {1661, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {1975, 106},
+    {0, 110},
+    {2217, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {2217, 213},
+    {0, 220},
+    {2349, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {2349, 213},
+    {0, 220},
+    {2217, 424},
+    {0, 440},
+    {1479, 106},
+    {0, 110},
+    {1661, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {1975, 106},
+    {0, 110},
+    {2217, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {2217, 213},
+    {0, 220},
+    {2489, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {2489, 213},
+    {0, 220},
+    {2217, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {2217, 213},
+    {0, 220},
+    {1479, 106},
+    {0, 110},
+    {1661, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {1975, 106},
+    {0, 110},
+    {2217, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {2217, 213},
+    {0, 220},
+    {2489, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {2489, 213},
+    {0, 220},
+    {2217, 424},
+    {0, 440},
+    {EV_TEMPO, 177},
+    {987, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1318, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 213},
+    {0, 220},
+    {1396, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1396, 213},
+    {0, 220},
+    {1318, 106},
+    {0, 110},
+    {1046, 106},
+    {0, 110},
+    {1318, 213},
+    {0, 220},
+    {987, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1318, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1975, 106},
+    {0, 110},
+    {1760, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1760, 783},
+    {0, 84},
+    {EV_TEMPO, 173},
+    {987, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1318, 110},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 214},
+    {0, 220},
+    {1396, 110},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1396, 213},
+    {0, 220},
+    {1318, 110},
+    {0, 110},
+    {1046, 106},
+    {0, 110},
+    {1318, 213},
+    {0, 220},
+    {987, 110},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1318, 106},
+    {0, 110},
+    {EV_TEMPO_RAMP, 16},
+    {EV_TEMPO, 161},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 106},
+    {1975, 106},
+    {0, 106},
+    {1479, 106},
+    {0, 106},
+    {1174, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1975, 106},
+    {0, 110},
+    {EV_TEMPO, 135},
+    {987, 933},
+    {0, 251},
+    {1661, 78},
+    {1760, 131},
+    {1864, 76},
+    {1975, 395},
+    {0, 1068},
+    {1661, 78},
+    {1760, 131},
+    {1864, 76},
+    {1975, 395},
+    {0, 918},
+    {493, 106},
+    {0, 110},
+    {554, 106},
+    {0, 110},
+    {587, 106},
+    {0, 110},
+    {659, 110},
+    {0, 110},
+    {739, 106},
+    {0, 110},
+    {587, 106},
+    {0, 110},
+    {739, 110},
+    {0, 110},
+    {987, 106},
+    {0, 110},
+    {932, 106},
+    {0, 110},
+    {739, 110},
+    {0, 110},
+    {932, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {987, 789},
+    {0, 236},
+    {1661, 78},
+    {1760, 131},
+    {1864, 76},
+    {1975, 395},
+    {0, 1068},
+    {1661, 78},
+    {1760, 131},
+    {1864, 76},
+    {1975, 395},
+    {0, 918},
+    {987, 110},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1318, 110},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 110},
+    {0, 110},
+    {1975, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {1479, 110},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {2217, 106},
+    {0, 110},
+    {1975, 789},
+    {0, 236},
+    {1661, 78},
+    {1760, 131},
+    {1864, 76},
+    {1975, 395},
+    {0, 1068},
+    {1661, 78},
+    {1760, 131},
+    {1864, 76},
+    {1975, 395},
+    {0, 1068},
+    {1661, 78},
+    {1760, 131},
+    {1864, 76},
+    {0, 106},
+    {1661, 122},
+    {1760, 131},
+    {1864, 76},
+    {0, 106},
+    {1661, 122},
+    {1760, 131},
+    {1864, 76},
+    {1975, 395},
+    {0, 42},
+    {1661, 78},
+    {1760, 131},
+    {1864, 76},
+    {1975, 110},
+    {0, 148},
+    {1661, 122},
+    {1760, 131},
+    {1864, 76},
+    {0, 106},
+    {1661, 122},
+    {1760, 131},
+    {1864, 76},
+    {1975, 395},
+    {0, 3694},
+    {1661, 78},
+    {1760, 131},
+    {1864, 76},
+    {1975, 395},
+};
+
+const uint16_t song_length = sizeof (song) / sizeof (song[0]);
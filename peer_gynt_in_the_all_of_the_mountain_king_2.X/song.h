@@ -0,0 +1,8 @@
+#ifndef SONG_H
+#define SONG_H
+
+#define SONG_TITLE "Peeg Gynt - In the hall of the mountain king."
+#define FREQ_DIVISOR 3.5 //step frequency = song frequency / FREQ_DIVISOR
+#define REVERSE_STEPS 140 //LA0 toggles between two head direction inversions
+
+#endif
@@ -0,0 +1,1245 @@
+#include "engine.h"
+
+const note_t song[] = { //{frequency, ms}, 0 Hz is a rest
+    {EV_VELOCITY, 32}, //pp on one drive, ff on UNISON_MAX in unison
+    {184, 1654},
+    {0, 84},
+    {61, 106},
+    {0, 110},
+    {69, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {82, 106},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {92, 213},
+    {0, 220},
+    {87, 106},
+    {0, 110},
+    {69, 106},
+    {0, 110},
+    {87, 213},
+    {0, 220},
+    {82, 106},
+    {0, 110},
+    {65, 106},
+    {0, 110},
+    {82, 213},
+    {0, 220},
+    {61, 106},
+    {0, 110},
+    {69, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {82, 106},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {123, 106},
+    {0, 110},
+    {110, 106},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {110, 781},
+    {0, 84},
+    {123, 106},
+    {0, 110},
+    {138, 106},
+    {0, 110},
+    {146, 106},
+    {0, 106},
+    {164, 106},
+    {0, 110},
+    {184, 106},
+    {0, 110},
+    {146, 106},
+    {0, 110},
+    {184, 213},
+    {0, 220},
+    {174, 106},
+    {0, 110},
+    {138, 106},
+    {0, 110},
+    {174, 213},
+    {0, 220},
+    {164, 106},
+    {0, 110},
+    {130, 106},
+    {0, 110},
+    {164, 213},
+    {0, 220},
+    {123, 106},
+    {0, 106},
+    {138, 106},
+    {0, 110},
+    {146, 106},
+    {0, 110},
+    {164, 106},
+    {0, 110},
+    {184, 106},
+    {0, 110},
+    {146, 106},
+    {0, 110},
+    {184, 106},
+    {0, 110},
+    {246, 106},
+    {0, 110},
+    {220, 106},
+    {0, 106},
+    {184, 106},
+    {0, 110},
+    {146, 106},
+    {0, 110},
+    {184, 106},
+    {0, 110},
+    {110, 781},
+    {0, 84},
+    {92, 106},
+    {0, 110},
+    {103, 106},
+    {0, 110},
+    {116, 106},
+    {0, 110},
+    {123, 106},
+    {0, 110},
+    {138, 106},
+    {0, 106},
+    {116, 106},
+    {0, 110},
+    {138, 213},
+    {0, 220},
+    {146, 106},
+    {0, 110},
+    {116, 106},
+    {0, 110},
+    {146, 213},
+    {0, 220},
+    {138, 106},
+    {0, 110},
+    {116, 106},
+    {0, 110},
+    {138, 213},
+    {0, 220},
+    {92, 106},
+    {0, 110},
+    {103, 106},
+    {0, 110},
+    {116, 106},
+    {0, 106},
+    {123, 106},
+    {0, 110},
+    {138, 106},
+    {0, 110},
+    {116, 106},
+    {0, 110},
+    {138, 213},
+    {0, 220},
+    {146, 106},
+    {0, 110},
+    {116, 106},
+    {0, 110},
+    {146, 213},
+    {0, 220},
+    {138, 425},
+    {0, 8},
+    {69, 213},
+    {0, 220},
+    {184, 106},
+    {0, 110},
+    {207, 106},
+    {0, 110},
+    {233, 106},
+    {0, 106},
+    {246, 106},
+    {0, 110},
+    {277, 106},
+    {0, 110},
+    {233, 106},
+    {0, 110},
+    {277, 213},
+    {0, 220},
+    {293, 106},
+    {0, 110},
+    {233, 106},
+    {0, 110},
+    {293, 213},
+    {0, 220},
+    {277, 106},
+    {0, 110},
+    {233, 106},
+    {0, 110},
+    {277, 213},
+    {0, 220},
+    {184, 106},
+    {0, 106},
+    {207, 106},
+    {0, 110},
+    {233, 106},
+    {0, 110},
+    {246, 106},
+    {0, 110},
+    {277, 106},
+    {0, 110},
+    {233, 106},
+    {0, 110},
+    {277, 213},
+    {0, 220},
+    {293, 106},
+    {0, 110},
+    {233, 106},
+    {0, 110},
+    {293, 213},
+    {0, 220},
+    {277, 425},
+    {0, 8},
+    {69, 213},
+    {0, 220},
+    {EV_TEMPO, 248},
+    {61, 106},
+    {0, 110},
+    {69, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {82, 106},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {92, 213},
+    {0, 220},
+    {87, 106},
+    {0, 110},
+    {69, 106},
+    {0, 110},
+    {87, 213},
+    {0, 220},
+    {82, 106},
+    {0, 110},
+    {65, 106},
+    {0, 110},
+    {82, 213},
+    {0, 220},
+    {61, 106},
+    {0, 110},
+    {69, 106},
+    {0, 110},
+    {73, 110},
+    {0, 110},
+    {82, 106},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {73, 110},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {123, 106},
+    {0, 111},
+    {110, 110},
+    {0, 110},
+    {92, 106},
+    {0, 110},
+    {73, 106},
+    {0, 110},
+    {92, 110},
+    {0, 110},
+    {110, 785},
+    {0, 85},
+    {123, 106},
+    {0, 110},
+    {138, 106},
+    {0, 111},
+    {146, 110},
+    {0, 110},
+    {164, 106},
+    {0, 110},
+    {184, 106},
+    {0, 110},
+    {146, 110},
+    {0, 110},
+    {184, 213},
+    {0, 220},
+    {174, 110},
+    {0, 110},
+    {138, 106},
+    {0, 110},
+    {174, 213},
+    {0, 221},
+    {164, 110},
+    {0, 110},
+    {130, 106},
+    {0, 110},
+    {164, 213},
+    {0, 221},
+    {123, 110},
+    {0, 110},
+    {138, 106},
+    {0, 110},
+    {146, 106},
+    {0, 110},
+    {164, 110},
+    {0, 110},
+    {184, 106},
+    {0, 110},
+    {146, 106},
+    {0, 111},
+    {184, 110},
+    {0, 110},
+    {246, 106},
+    {0, 110},
+    {184, 106},
+    {0, 110},
+    {146, 110},
+    {0, 110},
+    {184, 106},
+    {0, 110},
+    {246, 106},
+    {0, 111},
+    {123, 785},
+    {0, 85},
+    {246, 110},
+    {0, 110},
+    {277, 106},
+    {0, 110},
+    {184, 106},
+    {0, 2},
+    {87, 99},
+    {0, 10},
+    {329, 110},
+    {0, 110},
+    {369, 106},
+    {0, 110},
+    {293, 106},
+    {0, 111},
+    {184, 213},
+    {0, 4},
+    {92, 106},
+    {0, 111},
+    {349, 110},
+    {0, 110},
+    {277, 106},
+    {0, 110},
+    {184, 213},
+    {0, 4},
+    {92, 106},
+    {0, 110},
+    {329, 110},
+    {0, 110},
+    {261, 106},
+    {0, 110},
+    {184, 213},
+    {0, 4},
+    {92, 106},
+    {0, 110},
+    {246, 110},
+    {0, 110},
+    {277, 106},
+    {0, 110},
+    {184, 106},
+    {0, 2},
+    {87, 99},
+    {0, 10},
+    {329, 110},
+    {0, 110},
+    {369, 106},
+    {0, 110},
+    {293, 106},
+    {0, 111},
+    {369, 110},
+    {0, 2},
+    {87, 99},
+    {0, 10},
+    {493, 106},
+    {0, 110},
+    {440, 106},
+    {0, 110},
+    {369, 110},
+    {0, 110},
+    {220, 106},
+    {0, 2},
+    {103, 99},
+    {0, 10},
+    {369, 106},
+    {0, 111},
+    {440, 781},
+    {0, 85},
+    {493, 110},
+    {0, 110},
+    {554, 106},
+    {0, 110},
+    {369, 106},
+    {0, 2},
+    {87, 99},
+    {0, 10},
+    {659, 110},
+    {0, 110},
+    {739, 106},
+    {0, 110},
+    {587, 106},
+    {0, 111},
+    {369, 213},
+    {0, 4},
+    {92, 106},
+    {0, 111},
+    {698, 110},
+    {0, 110},
+    {554, 106},
+    {0, 110},
+    {369, 213},
+    {0, 4},
+    {92, 106},
+    {0, 110},
+    {659, 110},
+    {0, 110},
+    {523, 106},
+    {0, 110},
+    {369, 213},
+    {0, 4},
+    {92, 106},
+    {0, 110},
+    {493, 110},
+    {0, 110},
+    {554, 106},
+    {0, 110},
+    {369, 106},
+    {0, 2},
+    {87, 99},
+    {0, 10},
+    {659, 110},
+    {0, 110},
+    {739, 106},
+    {0, 110},
+    {587, 106},
+    {0, 111},
+    {739, 110},
+    {0, 2},
+    {87, 99},
+    {0, 10},
+    {987, 106},
+    {0, 110},
+    {880, 106},
+    {0, 110},
+    {739, 110},
+    {0, 110},
+    {440, 106},
+    {0, 2},
+    {103, 99},
+    {0, 10},
+    {739, 106},
+    {0, 111},
+    {880, 781},
+    {0, 85},
+    {369, 110},
+    {0, 110},
+    {415, 106},
+    {0, 110},
+    {466, 106},
+    {0, 2},
+    {130, 99},
+    {0, 10},
+    {493, 110},
+    {0, 110},
+    {554, 106},
+    {0, 110},
+    {466, 106},
+    {0, 111},
+    {554, 213},
+    {0, 4},
+    {138, 106},
+    {0, 111},
+    {587, 110},
+    {0, 110},
+    {466, 106},
+    {0, 110},
+    {587, 213},
+    {0, 4},
+    {146, 106},
+    {0, 110},
+    {554, 110},
+    {0, 110},
+    {466, 106},
+    {0, 110},
+    {554, 213},
+    {0, 4},
+    {138, 106},
+    {0, 110},
+    {369, 110},
+    {0, 110},
+    {415, 106},
+    {0, 110},
+    {466, 106},
+    {0, 2},
+    {130, 99},
+    {0, 10},
+    {493, 110},
+    {0, 110},
+    {554, 106},
+    {0, 110},
+    {466, 106},
+    {0, 111},
+    {554, 213},
+    {0, 4},
+    {138, 106},
+    {0, 111},
+    {587, 110},
+    {0, 110},
+    {466, 106},
+    {0, 110},
+    {587, 213},
+    {0, 4},
+    {146, 106},
+    {0, 110},
+    {554, 427},
+    {0, 9},
+    {369, 390},
+    {0, 43},
+    {739, 110},
+    {0, 110},
+    {830, 106},
+    {0, 110},
+    {932, 106},
+    {0, 2},
+    {130, 99},
+    {0, 10},
+    {987, 110},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {932, 106},
+    {0, 111},
+    {1108, 213},
+    {0, 4},
+    {138, 106},
+    {0, 111},
+    {1174, 110},
+    {0, 110},
+    {932, 106},
+    {0, 110},
+    {1174, 213},
+    {0, 4},
+    {146, 106},
+    {0, 110},
+    {1108, 110},
+    {0, 110},
+    {932, 106},
+    {0, 110},
+    {1108, 213},
+    {0, 4},
+    {138, 106},
+    {0, 110},
+    {739, 110},
+    {0, 110},
+    {830, 106},
+    {0, 110},
+    {932, 106},
+    {0, 2},
+    {130, 99},
+    {0, 10},
+    {987, 110},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {932, 106},
+    {0, 111},
+    {1108, 213},
+    {0, 4},
+    {138, 106},
+    {0, 111},
+    {1174, 110},
+    {0, 110},
+    {932, 106},
+    {0, 110},
+    {1174, 213},
+    {0, 4},
+    {146, 106},
+    {0, 110},
+    {1108, 427},
+    {0, 9},
+    {739, 390},
+    {0, 43},
+    {EV_VELOCITY, 64},
+    {EV_TEMPO, 161},
+    {246, 161},
+    {0, 55},
+    {87, 196},
+    {0, 20},
+    {92, 199},
+    {0, 20},
+    {184, 161},
+    {0, 55},
+    {87, 196},
+    {0, 20},
+    {92, 199},
+    {0, 20},
+    {369, 161},
+    {0, 55},
+    {87, 196},
+    {0, 20},
+    {92, 199},
+    {0, 20},
+    {184, 322},
+    {0, 112},
+    {92, 201},
+    {0, 20},
+    {349, 161},
+    {0, 55},
+    {87, 196},
+    {0, 20},
+    {92, 199},
+    {0, 20},
+    {184, 322},
+    {0, 112},
+    {92, 201},
+    {0, 20},
+    {329, 161},
+    {0, 55},
+    {87, 196},
+    {0, 20},
+    {92, 199},
+    {0, 20},
+    {184, 322},
+    {0, 112},
+    {92, 201},
+    {0, 20},
+    {246, 161},
+    {0, 55},
+    {87, 196},
+    {0, 20},
+    {92, 199},
+    {0, 20},
+    {184, 161},
+    {0, 55},
+    {87, 196},
+    {0, 20},
+    {92, 199},
+    {0, 20},
+    {369, 161},
+    {0, 55},
+    {87, 196},
+    {0, 20},
+    {92, 199},
+    {0, 20},
+    {246, 161},
+    {0, 55},
+    {87, 196},
+    {0, 20},
+    {92, 199},
+    {0, 20},
+    {440, 161},
+    {0, 55},
+    {103, 196},
+    {0, 20},
+    {110, 199},
+    {0, 20},
+    {220, 161},
+    {0, 55},
+    {103, 196},
+    {0, 20},
+    {110, 199},
+    {0, 20},
+    {440, 1241},
+    {0, 63},
+    {EV_TEMPO, 158},
+    {493, 161},
+    {0, 56},
+    {87, 197},
+    {0, 20},
+    {92, 200},
+    {0, 20},
+    {369, 161},
+    {0, 56},
+    {87, 197},
+    {0, 20},
+    {92, 200},
+    {0, 20},
+    {739, 161},
+    {0, 56},
+    {87, 197},
+    {0, 20},
+    {92, 200},
+    {0, 20},
+    {369, 320},
+    {0, 112},
+    {92, 200},
+    {0, 20},
+    {698, 161},
+    {0, 56},
+    {87, 197},
+    {0, 20},
+    {92, 200},
+    {0, 20},
+    {369, 320},
+    {0, 112},
+    {92, 200},
+    {0, 20},
+    {659, 161},
+    {0, 56},
+    {87, 197},
+    {0, 20},
+    {92, 200},
+    {0, 20},
+    {369, 320},
+    {0, 112},
+    {92, 200},
+    {0, 20},
+    {EV_VELOCITY, 96},
+    {EV_TEMPO, 155},
+    {493, 162},
+    {0, 55},
+    {87, 195},
+    {0, 20},
+    {92, 197},
+    {0, 20},
+    {EV_TEMPO, 226},
+    {EV_TEMPO_RAMP, 19},
+    {EV_TEMPO, 186},
+    {369, 110},
+    {0, 113},
+    {659, 110},
+    {0, 110},
+    {739, 106},
+    {0, 112},
+    {587, 106},
+    {0, 112},
+    {739, 110},
+    {0, 110},
+    {987, 110},
+    {0, 112},
+    {739, 110},
+    {0, 110},
+    {587, 110},
+    {0, 110},
+    {493, 327},
+    {0, 111},
+    {493, 782},
+    {0, 83},
+    {987, 106},
+    {0, 111},
+    {1108, 106},
+    {0, 111},
+    {1174, 106},
+    {0, 111},
+    {1318, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 111},
+    {1174, 106},
+    {0, 111},
+    {1479, 213},
+    {0, 3},
+    {92, 106},
+    {0, 110},
+    {1396, 106},
+    {0, 111},
+    {1108, 106},
+    {0, 111},
+    {1396, 213},
+    {0, 3},
+    {92, 106},
+    {0, 110},
+    {1318, 106},
+    {0, 111},
+    {1046, 106},
+    {0, 111},
+    {1318, 213},
+    {0, 3},
+    {92, 106},
+    {0, 110},
+    {987, 106},
+    {0, 111},
+    {1108, 106},
+    {0, 111},
+    {1174, 106},
+    {0, 111},
+    {1318, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 111},
+    {1174, 106},
+    {0, 111},
+    {1479, 106},
+    {0, 111},
+    {1975, 106},
+    {0, 110},
+    {1760, 106},
+    {0, 111},
+    {1479, 106},
+    {0, 111},
+    {1174, 106},
+    {0, 111},
+    {1479, 106},
+    {0, 110},
+    {1760, 780},
+    {0, 84},
+    {987, 106},
+    {0, 111},
+    {1108, 106},
+    {0, 111},
+    {1174, 106},
+    {0, 111},
+    {1318, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 111},
+    {1174, 106},
+    {0, 111},
+    {1479, 213},
+    {0, 3},
+    {92, 106},
+    {0, 110},
+    {1396, 106},
+    {0, 111},
+    {1108, 106},
+    {0, 111},
+    {1396, 213},
+    {0, 3},
+    {92, 106},
+    {0, 110},
+    {1318, 106},
+    {0, 111},
+    {1046, 106},
+    {0, 111},
+    {1318, 213},
+    {0, 3},
+    {92, 106},
+    {0, 110},
+    {987, 106},
+    {0, 111},
+    {1108, 106},
+    {0, 111},
+    {1174, 106},
+    {0, 111},
+    {1318, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 111},
+    {1174, 106},
+    {0, 111},
+    {1479, 106},
+    {0, 111},
+    {1975, 106},
+    {0, 110},
+    {1760, 106},
+    {0, 111},
+    {1479, 106},
+    {0, 111},
+    {880, 106},
+    {0, 111},
+    {1479, 106},
+    {0, 110},
+    {1760, 780},
+    {0, 84},
+    {1479, 106},
+    {0, 111},
+    {1661, 106},
+    {0, 111},
+    {1864, 106},
+    {0, 111},
+    {1975, 106},
+    {0, 110},
+    {2217, 106},
+    {0, 111},
+    {1864, 106},
+    {0, 110},
+    {2217, 213},
+    {0, 3},
+    {138, 106},
+    {0, 110},
+    {2349, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 111},
+    {2349, 213},
+    {0, 3},
+    {164, 106},
+    {0, 111},
+    {2217, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 111},
+    {2217, 213},
+    {0, 3},
+    {138, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1661, 106},
+    {0, 111},
+    {1864, 106},
+    {0, 111},
+    {1975, 106},
+    {0, 111},
+    {2217, 106},
+    {0, 111},
+    {1864, 106},
+    {0, 111},
+    {2217, 213},
+    {0, 3},
+    {138, 106},
+    {0, 111},
+    {2349, 106},
+    {0, 111},
+    {1864, 106},
+    {0, 111},
+    {2349, 213},
+    {0, 3},
+    {164, 106},
+    {0, 111},
+    {2217, 424},
+    {0, 9},
+    {146, 106},
+    {0, 111},
+    {138, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 111},
+    {1661, 106},
+    {0, 111},
+    {1864, 106},
+    {0, 111},
+    {1975, 106},
+    {0, 110},
+    {2217, 106},
+    {0, 111},
+    {1864, 106},
+    {0, 110},
+    {2217, 213},
+    {0, 3},
+    {138, 106},
+    {0, 110},
+    {2489, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 111},
+    {2489, 213},
+    {0, 3},
+    {174, 106},
+    {0, 111},
+    {2217, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 111},
+    {2217, 213},
+    {0, 3},
+    {138, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1661, 106},
+    {0, 111},
+    {1864, 106},
+    {0, 111},
+    {1975, 106},
+    {0, 111},
+    {2217, 106},
+    {0, 111},
+    {1864, 106},
+    {0, 111},
+    {2217, 213},
+    {0, 3},
+    {138, 106},
+    {0, 111},
+    {2489, 106},
+    {0, 111},
+    {1864, 106},
+    {0, 111},
+    {2489, 213},
+    {0, 3},
+    {174, 106},
+    {0, 111},
+    {2217, 424},
+    {0, 9},
+    {155, 106},
+    {0, 111},
+    {138, 106},
+    {0, 110},
+    {EV_VELOCITY, 127},
+    {EV_TEMPO, 176},
+    {987, 110},
+    {0, 110},
+    {1108, 106},
+    {0, 111},
+    {1174, 110},
+    {0, 110},
+    {1318, 106},
+    {0, 110},
+    {1479, 110},
+    {0, 110},
+    {1174, 106},
+    {0, 111},
+    {1479, 213},
+    {0, 3},
+    {92, 110},
+    {0, 110},
+    {1396, 106},
+    {0, 110},
+    {1108, 110},
+    {0, 110},
+    {1396, 213},
+    {0, 3},
+    {92, 106},
+    {0, 110},
+    {1318, 110},
+    {0, 110},
+    {1046, 106},
+    {0, 111},
+    {1318, 213},
+    {0, 3},
+    {92, 110},
+    {0, 110},
+    {987, 106},
+    {0, 110},
+    {1108, 110},
+    {0, 110},
+    {1174, 106},
+    {0, 111},
+    {1318, 110},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 110},
+    {0, 110},
+    {1479, 106},
+    {0, 111},
+    {1975, 110},
+    {0, 110},
+    {1760, 106},
+    {0, 110},
+    {1479, 110},
+    {0, 110},
+    {1174, 106},
+    {0, 111},
+    {1479, 110},
+    {0, 110},
+    {1760, 782},
+    {0, 85},
+    {EV_TEMPO, 173},
+    {987, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1318, 110},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 214},
+    {0, 3},
+    {92, 110},
+    {0, 110},
+    {1396, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1396, 213},
+    {0, 3},
+    {92, 106},
+    {0, 110},
+    {1318, 106},
+    {0, 110},
+    {1046, 106},
+    {0, 110},
+    {1318, 213},
+    {0, 3},
+    {92, 106},
+    {0, 110},
+    {987, 110},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1318, 106},
+    {0, 110},
+    {EV_TEMPO_RAMP, 18},
+    {EV_TEMPO, 161},
+    {1479, 106},
+    {0, 110},
+    {1174, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 106},
+    {1975, 106},
+    {0, 106},
+    {1479, 106},
+    {0, 106},
+    {1174, 106},
+    {0, 106},
+    {1479, 106},
+    {0, 110},
+    {1975, 106},
+    {0, 110},
+    {987, 780},
+    {0, 85},
+    {EV_TEMPO, 135},
+    {61, 393},
+    {0, 42},
+    {1174, 393},
+    {0, 918},
+    {61, 393},
+    {0, 42},
+    {1174, 393},
+    {0, 918},
+    {493, 106},
+    {0, 110},
+    {554, 106},
+    {0, 110},
+    {587, 106},
+    {0, 110},
+    {659, 106},
+    {0, 110},
+    {739, 106},
+    {0, 110},
+    {587, 110},
+    {0, 110},
+    {739, 106},
+    {0, 110},
+    {987, 106},
+    {0, 110},
+    {932, 110},
+    {0, 110},
+    {739, 106},
+    {0, 110},
+    {932, 106},
+    {0, 110},
+    {1108, 110},
+    {0, 110},
+    {987, 787},
+    {0, 84},
+    {61, 393},
+    {0, 42},
+    {1174, 393},
+    {0, 918},
+    {61, 393},
+    {0, 42},
+    {1174, 393},
+    {0, 918},
+    {987, 106},
+    {0, 110},
+    {1108, 106},
+    {0, 110},
+    {1174, 110},
+    {0, 110},
+    {1318, 106},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1174, 110},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1975, 106},
+    {0, 110},
+    {1864, 110},
+    {0, 110},
+    {1479, 106},
+    {0, 110},
+    {1864, 106},
+    {0, 110},
+    {2217, 110},
+    {0, 110},
+    {1975, 787},
+    {0, 84},
+    {61, 393},
+    {0, 42},
+    {1174, 395},
+    {0, 918},
+    {61, 393},
+    {0, 42},
+    {1174, 393},
+    {0, 918},
+    {61, 393},
+    {0, 42},
+    {1174, 391},
+    {0, 42},
+    {1174, 391},
+    {0, 42},
+    {1174, 393},
+    {0, 42},
+    {1661, 78},
+    {1760, 129},
+    {1864, 74},
+    {1174, 106},
+    {0, 42},
+    {1174, 391},
+    {0, 42},
+    {1174, 391},
+    {0, 42},
+    {1174, 393},
+    {0, 918},
+    {61, 99},
+    {0, 10},
+    {123, 99},
+    {0, 10},
+    {61, 99},
+    {0, 10},
+    {123, 99},
+    {0, 10},
+    {61, 99},
+    {0, 10},
+    {123, 99},
+    {0, 10},
+    {61, 99},
+    {0, 10},
+    {123, 99},
+    {0, 10},
+    {61, 99},
+    {0, 10},
+    {123, 99},
+    {0, 10},
+    {61, 99},
+    {0, 10},
+    {123, 99},
+    {0, 10},
+    {61, 99},
+    {0, 10},
+    {123, 99},
+    {0, 10},
+    {61, 99},
+    {0, 10},
+    {123, 99},
+    {0, 10},
+    {61, 99},
+    {0, 10},
+    {123, 99},
+    {0, 10},
+    {61, 99},
+    {0, 10},
+    {123, 99},
+    {0, 10},
+    {61, 99},
+    {0, 10},
+    {123, 99},
+    {0, 10},
+    {61, 99},
+    {0, 10},
+    {123, 99},
+    {0, 10},
+    {30, 393},
+    {0, 42},
+    {EV_TEMPO, 256},
+    {1174, 207},
+    {0, 40110},
+    {12, 8496},
+};
+
+const uint16_t song_length = sizeof (song) / sizeof (song[0]);
@@ -0,0 +1,487 @@
+#!/usr/bin/env python3
+"""Host side of the RS-485 board bus: framing, bandwidth, stand-in and sender.
+
+Every board built with BUS_ADDRESS=n listens on EUSART2 (see README.md). A
+frame is 9 bit characters: the address with the 9th bit set, then with it
+clear a type byte (kind in the high nibble, payload length in the low one),
+the payload and a CRC-8 (x^8 + x^2 + x + 1) of the address, type and payload.
+
+    BUS_NOTE 0x15  channel, frequency, ms (little endian): a note_t of song[]
+    BUS_STOP 0x20  silence now, drop the events not played yet
+    BUS_SYNC 0x34  master time in ms when it started the address byte
+    BUS_AT   0x17  BUS_NOTE and the low 16 bits of the board ms it plays at
+
+Each project given is one voice, sent to the board after its colon (default
+1, 2, ... in order, 255 for every board). Its notes go out at their onsets,
+its voice controls right after the note before them, so they are waiting
+when the board gets to them.
+
+    bus.py --table                          # frame time and boards per baud rate
+    bus.py XP_sounds.X Super_mario_floppy.X --standin 4 --errors 0.001
+    bus.py XP_sounds.X:1 Super_mario_floppy.X:2 --port /dev/ttyUSB0 --latency 20
+
+--standin runs one Linux process per board, each with the frame decoder of
+ISR_low() and bus_poll() and the queue of bus_play(), fed over pipes by the
+master process, and exits 1 when a board plays an event it was not sent or,
+with no --errors, misses one. Frames leave up to --jitter ms late; with
+--latency above it every note starts on its ms.
+--port needs pyserial; the address byte goes out with mark parity, the rest
+with space parity, as a PC UART has no 9 bit mode. It broadcasts a BUS_SYNC
+beacon every SYNC_MS.
+
+    bus.py --sync 5 --seconds 60 --jitter 1 --drift 0.5
+
+--sync simulates that many boards, their HFINTOSC spread over -2..+2%, locking
+their tick to the beacons with the integer math of sync_beacon() and ISR_low().
+It reports the time each takes to stay within --bound ms of the master and
+the worst error after that, and exits 1 if a board never gets there.
+"""
+
+import argparse
+import heapq
+import math
+import multiprocessing
+import os
+import random
+import struct
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from floppysim import Project  # noqa: E402
+
+BROADCAST = 0xFF
+BUS_NOTE = 0x15
+BUS_STOP = 0x20
+BUS_SYNC = 0x34
+BUS_AT = 0x17
+FRAME_MAX = 10  # BUS_FRAME of engine/engine.h
+BITS = 11  # start, 8 data, 9th, stop
+EV_BASE = 0xFF00
+EV = {"EV_GLIDE": 1, "EV_GLISS": 2, "EV_BEND_RANGE": 3, "EV_BEND": 4, "EV_VIBRATO_RATE": 5,
+      "EV_VIBRATO": 6, "EV_CHORD": 10, "EV_ARP_RATE": 11, "EV_DRUM": 12,
+      "EV_VELOCITY": 13, "EV_SPREAD": 14}  # tempo and articulation are done here
+RS485_LOADS = 32  # standard unit load transceivers on one segment
+SYMBOL = struct.Struct("<dH")  # time in s, 9 bit character
+SYNC_MS = 1000  # engine/engine.h
+SYNC_STEP_MS = 50
+SYNC_TRIM_MAX = 6144
+SYNC_KP = 128000 // SYNC_MS
+SYNC_KI = 32000 // SYNC_MS
+
+
+def crc8(data, crc=0):
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def frame(address, kind, payload=b""):
+    """9 bit characters of one frame."""
+    body = bytes([address, kind]) + bytes(payload)
+    return [0x100 | address] + list(body[1:]) + [crc8(body)]
+
+
+def note_frame(address, channel, frequency, ms):
+    return frame(address, BUS_NOTE, struct.pack("<BHH", channel, frequency, min(0xFFFF, ms)))
+
+
+class Receiver:
+    """ISR_low() and bus_poll() of a board, one character at a time."""
+
+    def __init__(self, address):
+        self.address = address
+        self.adden = True
+        self.frame = []
+        self.left = 0
+        self.ok = self.crc = self.lost = 0
+
+    def put(self, c):
+        """Returns the decoded frame (kind, payload) when c completes one, else None."""
+        if self.adden and not c & 0x100:
+            return None  # filtered by the EUSART
+        b = c & 0xFF
+        if c & 0x100:
+            self.left = 0
+            self.adden = True
+            if b in (self.address, BROADCAST):
+                self.frame = [b]
+                self.left = 1
+                self.adden = False
+            return None
+        if not self.left:
+            return None
+        self.frame.append(b)
+        self.left -= 1
+        if len(self.frame) == 2:
+            if b & 0x0F > FRAME_MAX - 3:
+                self.lost += 1
+            else:
+                self.left = (b & 0x0F) + 1
+        if self.left:
+            return None
+        self.adden = True
+        if len(self.frame) <= 2:
+            return None
+        if crc8(self.frame[:-1]) != self.frame[-1]:
+            self.crc += 1
+            return None
+        self.ok += 1
+        return self.frame[1], bytes(self.frame[2:-1])
+
+
+def voices(specs):
+    """[(address, [(onset s, frequency, ms, [(EV_ value, arg)])])] of project[:address] specs."""
+    result = []
+    for k, spec in enumerate(specs):
+        path, _, address = spec.partition(":")
+        project = Project(path)
+        events, t = [], 0.0
+        for i, (frequency, ms) in enumerate(project.events):
+            controls = [(EV_BASE + EV[name], arg) for name, arg in project.controls.get(i, [])
+                        if name in EV]
+            if frequency or controls:
+                events.append((t, frequency, int(round(ms)), controls))
+            t += ms / 1000.0
+        result.append((int(address) if address else k + 1, events))
+    return result
+
+
+def at_frame(address, channel, frequency, ms, at):
+    return frame(address, BUS_AT, struct.pack("<BHHH", channel, frequency, min(0xFFFF, ms),
+                                              at & 0xFFFF))
+
+
+def schedule(tracks, latency=None, start=0.0):
+    """[(time s, characters, address, event, play s)] in wire order, event = (frequency, ms).
+
+    With a latency in ms the frames are BUS_AT, sent at the onset to play that
+    much later, their controls just before them. Without, BUS_NOTE frames play
+    on arrival, their controls go out after the note before. The song starts
+    start s after the first beacon.
+    """
+    queued = []
+    for channel, (address, events) in enumerate(tracks):
+        early = start
+        for t, frequency, ms, controls in events:
+            t += start
+            for event, arg in controls:
+                queued.append((t if latency is not None else early, address, channel, event, arg, t))
+            if frequency:
+                queued.append((t, address, channel, frequency, ms, t))
+                early = t
+    queued.sort(key=lambda q: q[0])
+    if latency is None:
+        return [(t, note_frame(a, c & 0x0F, f, ms), a, (f, ms), t) for t, a, c, f, ms, _ in queued]
+    return [(t, at_frame(a, c & 0x0F, f, ms, int(round(on * 1e3 + latency))), a, (f, ms),
+             on + latency / 1e3) for t, a, c, f, ms, on in queued]
+
+
+def wire_times(frames, baud):
+    """Start time of each frame, each waits for the line to be free."""
+    free, starts = 0.0, []
+    char = BITS / baud
+    for t, chars, _, _, _ in frames:
+        start = max(t, free)
+        starts.append(start)
+        free = start + len(chars) * char
+    return starts
+
+
+def fire(received):
+    """[(frequency, ms, arrival s, start s)] as bus_play() takes them from the
+    time sorted queue, one note at a time, from [(arrival s, at or None,
+    frequency, ms)]. The board time is the master's, as after the lock."""
+    played, queue = [], []
+    now = end = i = 0
+    while i < len(received) or queue:
+        while i < len(received) and received[i][0] * 1e3 <= now:
+            arrival, at, frequency, ms = received[i]
+            due = stamp = int(arrival * 1e3)
+            if at is not None:
+                due += max(0, ((at - stamp + 0x8000) & 0xFFFF) - 0x8000)  # late ones play now
+            heapq.heappush(queue, (due, i, arrival, frequency, ms))
+            i += 1
+        if queue and queue[0][0] <= now and end <= now:
+            _, _, arrival, frequency, ms = heapq.heappop(queue)
+            played.append((frequency, ms, arrival, now / 1e3))
+            if frequency < EV_BASE:
+                end = now + ms
+            continue
+        later = [math.ceil(received[i][0] * 1e3)] if i < len(received) else []
+        if queue:
+            later.append(max(queue[0][0], end))
+        now = min(later)
+    return played
+
+
+def board(address, fd, others, results):
+    """Stand-in of one board: decodes the wire, plays the events one after the other."""
+    for other in others:  # the write ends must all close for the wire to end
+        os.close(other)
+    rx = Receiver(address)
+    received = []
+    buf = b""
+    with os.fdopen(fd, "rb") as wire:
+        while True:
+            chunk = wire.read(SYMBOL.size * 256)
+            if not chunk:
+                break
+            buf += chunk
+            n = len(buf) // SYMBOL.size * SYMBOL.size
+            for t, c in SYMBOL.iter_unpack(buf[:n]):
+                got = rx.put(c)
+                if got is not None and got[0] == BUS_NOTE:
+                    received.append((t, None) + struct.unpack("<BHH", got[1])[1:])
+                elif got is not None and got[0] == BUS_AT:
+                    _, frequency, ms, at = struct.unpack("<BHHH", got[1])
+                    received.append((t, at, frequency, ms))
+            buf = buf[n:]
+    results.put((address, fire(received), rx.ok, rx.crc, rx.lost))
+
+
+def standin(tracks, boards, baud, errors, jitter, latency, seed):
+    rng = random.Random(seed)
+    frames = schedule(tracks, latency)
+    starts = wire_times([(f[0] + rng.uniform(0, jitter / 1e3),) + f[1:] for f in frames], baud)
+    char = BITS / baud
+    results = multiprocessing.Queue()
+    ends = [os.pipe() for _ in range(boards)]
+    procs = []
+    for address, (r, _) in enumerate(ends, 1):
+        others = [fd for pair in ends for fd in pair if fd != r]
+        p = multiprocessing.Process(target=board, args=(address, r, others, results))
+        p.start()
+        procs.append(p)
+    pipes = []
+    for r, w in ends:
+        os.close(r)
+        pipes.append(os.fdopen(w, "wb"))
+    flipped = 0
+    for start, (_, chars, _, _, _) in zip(starts, frames):
+        data = []
+        for i, c in enumerate(chars):
+            if errors and rng.random() < errors:
+                c ^= 1 << rng.randrange(9)
+                flipped += 1
+            data.append(SYMBOL.pack(start + (i + 1) * char, c))  # time of the stop bit
+        data = b"".join(data)
+        for w in pipes:
+            w.write(data)
+    for w in pipes:
+        w.close()
+    got = dict((r[0], r[1:]) for r in (results.get() for _ in procs))
+    for p in procs:
+        p.join()
+
+    expected = {a: [] for a in range(1, boards + 1)}
+    onset = {a: [] for a in range(1, boards + 1)}
+    target = {a: [] for a in range(1, boards + 1)}
+    for t, _, address, event, play in frames:
+        for a in (expected if address == BROADCAST else [address] if address in expected else []):
+            expected[a].append(event)
+            onset[a].append(t)
+            target[a].append(play)
+    failed = False
+    print("%-6s %7s %7s %6s %6s %6s %11s %11s"
+          % ("board", "frames", "played", "CRC", "lost", "wrong", "wire max", "start err"))
+    for a in range(1, boards + 1):
+        played, ok, crc, lost = got[a]
+        events = [(f, ms) for f, ms, _, _ in played]
+        wrong = missing = 0
+        i = 0
+        wire_late = start_late = 0.0
+        for k, event in enumerate(events):  # played must be in order in the sent ones
+            j = None  # the last one sent before it arrived, repeated notes are alike
+            for n in range(i, len(expected[a])):
+                if onset[a][n] > played[k][2]:
+                    break
+                if expected[a][n] == event:
+                    j = n
+            if j is None:
+                wrong += 1
+                continue
+            missing += j - i
+            i = j
+            if event[0] < EV_BASE:
+                wire_late = max(wire_late, played[k][2] - onset[a][i])
+                start_late = max(start_late, abs(played[k][3] - target[a][i]))
+            i += 1
+        missing += len(expected[a]) - i
+        print("%-6d %7d %7d %6d %6d %6d %8.3f ms %8.3f ms"
+              % (a, ok, len(events), crc, lost, wrong, 1e3 * wire_late, 1e3 * start_late))
+        failed |= wrong > 0 or (not errors and missing > 0)
+    print("%d %s frames at %d baud, sent up to %.1f ms late, %d characters flipped"
+          % (len(frames), "BUS_NOTE" if latency is None else "BUS_AT, %g ms ahead," % latency,
+             baud, jitter, flipped))
+    return failed
+
+
+def print_table(tracks):
+    size = len(note_frame(1, 0, 440, 100))
+    rates = []
+    for _, events in tracks:
+        notes = [t for t, f, _, _ in events if f]
+        if len(notes) > 1:
+            rates.append((len(notes) - 1) / (notes[-1] - notes[0]))
+    rate = max(rates) if rates else 20.0
+    print("BUS_NOTE: %d characters of %d bits; %.1f events/s per board%s"
+          % (size, BITS, rate, " (mean of the busiest voice)" if rates else ""))
+    print("%-8s %10s %10s %12s %12s" % ("baud", "frame", "events/s", "boards", "chord skew"))
+    for baud in (19200, 115200, 250000, 500000, 1000000):
+        t = size * BITS / baud
+        boards = min(254, int(1 / t / rate))
+        print("%-8d %7.0f us %10d %12d %9.2f ms"
+              % (baud, 1e6 * t, int(1 / t), boards, 1e3 * t * (min(boards, RS485_LOADS) - 1)))
+    print("boards: at that event rate each, the addresses stop at 254 and a segment at %d"
+          " unit loads; chord skew: last of %d boards sent the same onset"
+          % (RS485_LOADS, RS485_LOADS))
+
+
+class SyncBoard:
+    """Timer2 tick of one board, trimmed by ISR_low() and sync_beacon()."""
+
+    def __init__(self, error):
+        self.rate = 1 + error  # HFINTOSC over its nominal frequency
+        self.ms = 0  # sync_ms
+        self.trim = self.acc = self.sum = 0
+        self.lock = False
+        self.next = 1000 / self.rate  # us of the master at the end of the tick
+
+    def tick(self):
+        self.ms += 1
+        self.acc += self.trim
+        n = self.acc >> 10
+        self.acc -= n << 10
+        self.next += 4 * (250 - n) / self.rate  # PR2 + 1 counts of 1 us, 4 times
+
+    def beacon(self, master, stamp):
+        e = master - stamp
+        if not self.lock or abs(e) > SYNC_STEP_MS:
+            self.ms += e
+            self.lock = True
+            return
+        limit = SYNC_TRIM_MAX // SYNC_KI
+        self.sum = max(-limit, min(limit, self.sum + e))
+        self.trim = max(-SYNC_TRIM_MAX, min(SYNC_TRIM_MAX, SYNC_KP * e + SYNC_KI * self.sum))
+
+
+def print_sync(boards, seconds, jitter, drift, bound, baud, seed):
+    """Error of each board against the master, ms, per tick."""
+    rng = random.Random(seed)
+    errors = [-0.02 + 0.04 * k / max(1, boards - 1) for k in range(boards)]
+    delay = BITS / baud * 1e6  # the address byte, then ISR_low() stamps
+    print("%-6s %8s %8s %10s %10s %12s"
+          % ("board", "HFINTOSC", "trim", "locked", "max error", "free running"))
+    failed = False
+    for k, error in enumerate(errors):
+        b = SyncBoard(error)
+        beacon = 0.0
+        locked, worst = None, 0.0
+        end = seconds * 1e6
+        while b.next < end:
+            sent = beacon + rng.uniform(0, jitter * 1e3)
+            while b.next < min(sent + delay, end):
+                t = b.next
+                b.tick()
+                skew = b.ms - t / 1e3
+                if abs(skew) > bound:
+                    locked = None
+                elif locked is None:
+                    locked = t
+                if t > end / 2:
+                    worst = max(worst, abs(skew))
+                b.rate = 1 + error + drift / 100 * t / 60e6
+            if sent + delay < end:  # the time was read before the adapter delay
+                b.beacon(int(beacon / 1e3), b.ms)
+            beacon += SYNC_MS * 1e3
+        print("%-6d %7.2f%% %7.2f%% %8.1f s %7.2f ms %9.0f ms"
+              % (k + 1, 100 * error, 100 * b.trim / 256e3,
+                 (locked or 0) / 1e6 if locked is not None else float("nan"), worst,
+                 1e3 * seconds * (error + drift / 100 * seconds / 120)))
+        failed |= locked is None
+    print("beacon every %d ms, jitter up to %.1f ms, drift %.2f%%/min, bound %.1f ms"
+          % (SYNC_MS, jitter, drift, bound))
+    return failed
+
+
+def put_frame(line, chars):
+    import serial
+    line.parity = serial.PARITY_MARK
+    line.write(bytes([chars[0] & 0xFF]))
+    line.flush()
+    line.parity = serial.PARITY_SPACE
+    line.write(bytes(chars[1:]))
+    line.flush()
+
+
+def send(frames, port, baud):
+    import serial  # pyserial, only for real hardware
+    line = serial.Serial(port, baud, bytesize=8, parity=serial.PARITY_SPACE, stopbits=1)
+    t0 = time.monotonic()
+    beacon = 0.0
+    for t, chars, _, _, _ in frames + [(frames[-1][0] if frames else 0.0, None, None, None, None)]:
+        while True:
+            now = time.monotonic() - t0
+            if beacon <= now:
+                put_frame(line, frame(BROADCAST, BUS_SYNC,
+                                      struct.pack("<I", int((time.monotonic() - t0) * 1e3))))
+                beacon += SYNC_MS / 1e3
+            elif t <= now:
+                break
+            else:
+                time.sleep(min(t, beacon) - now)
+        if chars is not None:
+            put_frame(line, chars)
+    put_frame(line, frame(BROADCAST, BUS_STOP))
+    line.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("voices", nargs="*", metavar="PROJECT[:ADDRESS]",
+                        help=".X project of a voice and the board that plays it")
+    parser.add_argument("--baud", type=int, default=250000, help="BUS_BAUD of the boards")
+    parser.add_argument("--table", action="store_true",
+                        help="frame time, events per second and boards per baud rate")
+    parser.add_argument("--standin", type=int, metavar="BOARDS",
+                        help="play the voices to this many board processes and check them")
+    parser.add_argument("--errors", type=float, default=0.0,
+                        help="chance of one bit flipped per character on the stand-in wire")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--port", help="serial device of an RS-485 adapter, sends the voices")
+    parser.add_argument("--sync", type=int, metavar="BOARDS",
+                        help="simulate the tick lock of this many boards to the beacons")
+    parser.add_argument("--seconds", type=float, default=60.0, help="length of --sync")
+    parser.add_argument("--jitter", type=float, default=1.0,
+                        help="ms a frame can leave late, USB adapters add about 1")
+    parser.add_argument("--latency", type=float,
+                        help="send BUS_AT frames to play this many ms after they are sent")
+    parser.add_argument("--lead", type=float, default=0.0,
+                        help="s of beacons before the song on --port, 15 lets the boards lock")
+    parser.add_argument("--drift", type=float, default=0.0,
+                        help="HFINTOSC change in %% per minute, temperature")
+    parser.add_argument("--bound", type=float, default=1.0, help="ms of error --sync accepts")
+    args = parser.parse_args()
+
+    tracks = voices(args.voices)
+    failed = False
+    if args.table:
+        print_table(tracks)
+    if args.standin:
+        failed = standin(tracks, args.standin, args.baud, args.errors, args.jitter, args.latency,
+                         args.seed)
+    if args.sync:
+        failed |= print_sync(args.sync, args.seconds, args.jitter, args.drift, args.bound,
+                             args.baud, args.seed)
+    if args.port:
+        send(schedule(tracks, args.latency, args.lead), args.port, args.baud)
+    if not (args.table or args.standin or args.port or args.sync):
+        parser.error("nothing to do, give --table, --standin, --sync and/or --port")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
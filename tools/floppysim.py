@@ -0,0 +1,715 @@
+#!/usr/bin/env python3
+"""Host timing model of the floppy player firmware.
+
+Reads the song.c of a project, replays it with the same Timer1 arithmetic as
+Beep() and ISR(), and writes the RA0/RA1 drive lines plus the PROBE pins
+(RB0 ISR, RB1 note, RB2 direction flip) as a VCD file, the same format a
+sigrok capture of the real board is exported to.
+
+    floppysim.py XP_sounds.X -o xp.vcd
+    floppysim.py XP_sounds.X --notes      # expected step frequency per note
+    floppysim.py XP_sounds.X --timing     # note timing error per duration model
+    floppysim.py XP_sounds.X --power      # clock levels, current, note latency
+    floppysim.py XP_sounds.X --drives 3 --channel Super_mario_floppy.X --policy bass
+                                          # note allocation over several drives
+    floppysim.py XP_sounds.X --fanout     # 74HC595 chain tick rate per drive count
+
+The CPU costs are estimates, in ns at 64 MHz (62.5 ns per instruction):
+override them with the measurements of an INSTRUMENT build.
+"""
+
+import argparse
+import ctypes
+import math
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+TMR1_TICK_NS = 500  # FOSC/4 with 1:8 prescaler
+CYCLE_NS = 62.5
+
+DEFAULTS = {
+    "isr_latency_ns": 40 * CYCLE_NS,  # TMR1 overflow to the reload
+    "isr_ns": 60 * CYCLE_NS,  # whole ISR, RB0 high time
+    "setup_ns": 1500 * CYCLE_NS,  # Beep() float math before the timer runs
+    "loop_ns": None,  # extra cost of each 1 ms iteration, default per model
+    "tick_ns": 120 * CYCLE_NS,  # Timer2 ISR plus one wait_tick() round
+}
+
+
+ENGINE_DEFAULTS = {"FREQ_DIVISOR": "4", "REVERSE_STEPS": "140"}  # engine/engine.h
+DRUM_NAMES = {"DRUM_KICK": 0, "DRUM_SNARE": 1, "DRUM_HAT": 2}
+
+
+class Project:
+    """Song events and engine parameters of one .X project."""
+
+    def __init__(self, path):
+        self.path = path
+        self.name = os.path.basename(os.path.normpath(path))
+        config = dict(ENGINE_DEFAULTS)
+        with open(os.path.join(path, "song.h")) as f:
+            for m in re.finditer(r"#define (\w+) (\S+)", f.read()):
+                config[m.group(1)] = m.group(2)
+        self.divisor = float(config["FREQ_DIVISOR"])
+        self.reverse = int(config["REVERSE_STEPS"])
+        with open(os.path.join(path, "song.c")) as f:
+            src = f.read()
+        # (frequency, ms), frequency 0 is a rest, ms after the tempo map and
+        # the articulation; controls[i] lists the (EV_ name, argument) control
+        # events before events[i]
+        self.events = []
+        self.controls = {}
+        pending = []
+        tempo = TempoMap()
+        artic = 256
+        for m in re.finditer(r"\{(\w+), (\d+|DRUM_\w+)\}", src):
+            if m.group(1).isdigit():
+                if pending:
+                    self.controls[len(self.events)] = pending
+                    pending = []
+                frequency, ms = int(m.group(1)), int(m.group(2))
+                tempo.next()
+                gate = ms if frequency == 0 else max(1, min(ms, (ms * artic) >> 8))
+                self.events.append((frequency, float(tempo.scale(gate))))
+                if gate < ms:  # the gap play() rests after an articulated note
+                    self.events.append((0, float(tempo.scale(ms - gate))))
+            elif m.group(1).startswith("EV_"):
+                arg = DRUM_NAMES.get(m.group(2), 0xFF) if m.group(2).startswith("DRUM_") else int(m.group(2))
+                pending.append((m.group(1), arg))
+                tempo.control(m.group(1), arg)
+                if m.group(1) == "EV_ARTIC":
+                    artic = max(1, min(256, arg))
+
+    def step_frequency(self, frequency):
+        """Divided frequency and TMR1 reload, as computed by Beep()."""
+        f = int(frequency / self.divisor)
+        offset = int(65535 - 1000000.0 / f)
+        return f, offset
+
+
+class TempoMap:
+    """Score tempo of EV_TEMPO and EV_TEMPO_RAMP, the integer math of tempo_next()."""
+
+    def __init__(self):
+        self.tempo = 256
+        self.ramp = self.left = 0
+        self.acc = self.step = self.target = 0
+
+    def control(self, name, arg):
+        if name == "EV_TEMPO_RAMP":
+            self.ramp = arg
+        elif name == "EV_TEMPO":
+            arg = max(16, min(4096, arg))
+            self.left, self.ramp = self.ramp, 0
+            if not self.left:
+                self.tempo = arg
+            else:
+                self.target = arg
+                self.acc = self.tempo << 8
+                self.step = cdiv((arg - self.tempo) << 8, self.left)
+
+    def next(self):
+        """Step of a ramp, before every timed event."""
+        if self.left:
+            self.acc += self.step
+            self.left -= 1
+            self.tempo = self.target if self.left == 0 else self.acc >> 8
+
+    def scale(self, ms):
+        """As scale_duration() with the console tempo at 256/256."""
+        return min(0xFFFF, (ms * self.tempo) >> 8)
+
+
+def half_period_ns(offset, costs):
+    return (65536 - offset) * TMR1_TICK_NS + costs["isr_latency_ns"]
+
+
+LFO_SINE = [round(127 * math.sin(2 * math.pi * k / 64)) for k in range(64)]  # lfo_sine[]
+SEMITONE_RATIO = [32768, 34716, 36781, 38968, 41285, 43740,
+                  46341, 49097, 52016, 55109, 58386, 61858]  # engine/engine.c
+MIN_HALF_PERIOD = 40
+# drum_kit[]: ms, first half period, slope per ms, reverse, noise mask; None
+# in reverse is REVERSE_STEPS, the others get the sweep state back after the hit
+DRUM_KIT = [(30, 400, 40, None, 0), (20, 240, 0, 2, 0x7F), (1, 960, 0, None, 0)]
+
+
+def period_factor(k):
+    return 65536 if k == 0 else SEMITONE_RATIO[12 - k]
+
+
+def period_at(base, p):
+    """Half period of base moved by p/256 semitones, as period_at() computes it."""
+    octave = 0
+    while p < 0:
+        p += 12 * 256
+        octave -= 1
+    while p >= 12 * 256:
+        p -= 12 * 256
+        octave += 1
+    k = p >> 8
+    a = period_factor(k)
+    a -= ((a - period_factor(k + 1)) * (p & 0xFF)) >> 8
+    counts = (base * a) >> 16
+    counts = counts >> octave if octave > 0 else counts << -octave
+    return max(MIN_HALF_PERIOD, min(65535, counts))
+
+
+def pitch_between(frm, to):
+    """p with period_at(to, p) == frm, as pitch_between() computes it."""
+    p = 0
+    while frm > to:
+        to <<= 1
+        p -= 12 * 256
+    while frm * 2 <= to:
+        frm <<= 1
+        p += 12 * 256
+    q = (frm << 16) // to
+    k = 0
+    while k < 11 and q <= period_factor(k + 1):
+        k += 1
+    a, b = period_factor(k), period_factor(k + 1)
+    return p + k * 256 + ((a - q) << 8) // (a - b)
+
+
+def cdiv(a, b):
+    """C integer division, truncated towards zero."""
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+class Voice:
+    """Pitch state of the drive, the integer math of the voice_ functions."""
+
+    def __init__(self):
+        self.last = 0
+        self.glide = 0
+        self.gliss = False
+        self.bend_range = 2
+        self.bend = 0
+        self.lfo_step = 360
+        self.vibrato = 0
+        self.chord = []
+        self.arp_rate = 50
+        self.drum = None
+        self.lfsr = 0xACE1  # drum_lfsr
+
+    def control(self, name, arg):
+        if name in ("EV_GLIDE", "EV_GLISS"):
+            self.glide = arg
+            self.gliss = name == "EV_GLISS"
+        elif name == "EV_BEND_RANGE":
+            self.bend_range = arg
+        elif name == "EV_BEND":
+            self.bend = ((arg - 8192) * self.bend_range) >> 5
+        elif name == "EV_VIBRATO_RATE":
+            self.lfo_step = (min(arg, 1000) * 65536 + 5000) // 10000
+        elif name == "EV_VIBRATO":
+            self.vibrato = (min(arg, 1200) * 256 + 50) // 100
+        elif name == "EV_CHORD":
+            if 0 < arg < 0xFF00 and len(self.chord) < 3:
+                self.chord.append(arg)
+        elif name == "EV_ARP_RATE":
+            self.arp_rate = max(1, min(1000, arg))
+        elif name == "EV_DRUM":
+            self.drum = arg if arg < len(DRUM_KIT) else None
+
+    def hit(self, ms):
+        """TMR1 reloads and direction inversion count of the pending EV_DRUM,
+        one reload per ms of the hit as drum_hit() sets them, or None."""
+        if self.drum is None:
+            return None
+        length, half, slope, reverse, noise = DRUM_KIT[self.drum]
+        self.drum = None
+        n = min(length, int(ms))
+        if n == 0:
+            return None
+        out = [65535 - half]
+        for _ in range(n - 1):
+            half += slope
+            self.lfsr = (self.lfsr >> 1) ^ (0xB400 if self.lfsr & 1 else 0)
+            out.append(65535 - (half + (self.lfsr & noise)))
+        return out, reverse
+
+    def reload(self, base, pitch, lfo=0):
+        p = (pitch >> 8) + self.bend
+        if self.gliss:
+            p = (p + 128) & ~0xFF
+        p += lfo
+        return 65535 - base if p == 0 else 65535 - period_at(base, p)
+
+    def offsets(self, offset, ms, frequency):
+        """TMR1 reload of a note before its first tick and after each tick."""
+        base = 65535 - offset
+        arp = [base] + [max(MIN_HALF_PERIOD, min(65535, (base * frequency + f // 2) // f))
+                        for f in self.chord]
+        self.chord = []
+        arp_i = arp_acc = 0
+        pitch = slide = slide_ms = 0
+        if self.glide and self.last:
+            slide_ms = max(1, self.glide)
+            pitch = pitch_between(self.last, base) << 8
+            slide = cdiv(-pitch, slide_ms)
+        self.glide = 0
+        self.last = base
+        depth, self.vibrato = self.vibrato, 0
+        phase = lfo = 0
+        out = [self.reload(base, pitch)]
+        for _ in range(int(ms)):
+            moved = False
+            if len(arp) > 1:
+                arp_acc += self.arp_rate
+                if arp_acc >= 1000:
+                    arp_acc -= 1000
+                    arp_i = (arp_i + 1) % len(arp)
+                    base = arp[arp_i]
+                    moved = True
+            if depth:
+                phase = (phase + self.lfo_step) & 0xFFFF
+                value = (LFO_SINE[phase >> 10] * depth) >> 7
+                moved = value != lfo
+                lfo = value
+            if slide_ms:
+                pitch += slide
+                slide_ms -= 1
+                if slide_ms == 0:
+                    pitch = 0
+                    self.gliss = False
+                moved = True
+            out.append(self.reload(base, pitch, lfo) if moved else out[-1])
+        return out
+
+
+# How the firmware counts note durations:
+#   double  Beep(int, double) of the old Super Mario project, a soft float
+#           compare against the duration every ms of __delay_ms(1)
+#   delay   uint16_t loop of __delay_ms(1), stretched by the ISR time
+#   tick    Timer2 1 ms ticks, the engine since the integer tick change
+MODELS = {
+    "double": {"loop_ns": 250 * CYCLE_NS, "stretch": True},
+    "delay": {"loop_ns": 10 * CYCLE_NS, "stretch": True},
+    "tick": {"loop_ns": 0.0, "stretch": False},
+}
+TICK_NS = 1e6
+
+
+def simulate(project, costs, limit=None, model="tick"):
+    """Yield (time ns, signal, value) for every pin change, in time order."""
+    t = 0.0
+    lines = {"step": 0, "direction": 0, "cnt": 0}
+    stretch = MODELS[model]["stretch"]
+    loop_ns = costs["loop_ns"] if costs["loop_ns"] is not None else MODELS[model]["loop_ns"]
+    events = project.events if limit is None else project.events[:limit]
+    voice = Voice()
+
+    def edges(t, end, reloads, reverse):
+        """Changes of the timer running from t to end, returns end, later if
+        stretched by the ISR."""
+        first_tick = t // TICK_NS
+        period = half_period_ns(reloads[0], costs)
+        next_isr = t + period - costs["isr_latency_ns"]  # overflow time
+        while next_isr < end:
+            yield next_isr, "RB0", 1
+            edge = next_isr + costs["isr_latency_ns"]
+            lines["step"] ^= 1
+            lines["cnt"] = (lines["cnt"] + 1) & 0xFF
+            yield edge, "RA0", lines["step"]
+            if lines["cnt"] >= reverse:
+                lines["cnt"] = 0
+                lines["direction"] ^= 1
+                yield edge + CYCLE_NS, "RB2", 1
+                yield edge + 2 * CYCLE_NS, "RA1", lines["direction"]
+                yield edge + 3 * CYCLE_NS, "RB2", 0
+            yield next_isr + costs["isr_ns"], "RB0", 0
+            if stretch:
+                # the ISR steals its time from the __delay_ms() busy loop
+                end += costs["isr_ns"]
+            # the reload in effect at this edge, voice_tick() runs after each tick
+            ticks = int(next_isr // TICK_NS - first_tick)
+            period = half_period_ns(reloads[min(ticks, len(reloads) - 1)], costs)
+            next_isr += period
+        return end
+
+    for i, (frequency, ms) in enumerate(events):
+        for name, arg in project.controls.get(i, []):
+            voice.control(name, arg)
+        hit = voice.hit(ms)
+        if hit:  # drum_hit() before the note or the rest, no RB1 pulse
+            reloads, reverse = hit
+            end = (t // TICK_NS + len(reloads)) * TICK_NS
+            if stretch:
+                end = t + len(reloads) * (1e6 + loop_ns)
+            sweep = dict(lines)
+            t = yield from edges(t, end, reloads, reverse or project.reverse)
+            if reverse is not None:  # the snare: cnt and LA1 as before the hit
+                lines["cnt"] = sweep["cnt"]
+                if lines["direction"] != sweep["direction"]:
+                    lines["direction"] = sweep["direction"]
+                    yield t, "RA1", lines["direction"]
+            ms -= len(reloads)
+        if stretch:
+            end = t + costs["setup_ns"] * (frequency != 0) + ms * (1e6 + loop_ns)
+        else:
+            # the first wait_tick() returns at the next Timer2 tick
+            end = (t // TICK_NS + ms) * TICK_NS
+        if frequency == 0:
+            t = end
+            continue
+        t += costs["setup_ns"]
+        _, offset = project.step_frequency(frequency)
+        reloads = voice.offsets(offset, ms, frequency)
+        yield t, "RB1", 1
+        t = yield from edges(t, end, reloads, project.reverse)
+        yield t, "RB1", 0
+
+
+def timing_error(project, costs, model):
+    """Per note start and length error against the score, in ms."""
+    nominal = []
+    t = 0.0
+    for frequency, ms in project.events:
+        if frequency:
+            nominal.append((t, ms))
+        t += ms
+    starts = [c[0] for c in simulate(project, costs, model=model) if c[1] == "RB1" and c[2] == 1]
+    stops = [c[0] for c in simulate(project, costs, model=model) if c[1] == "RB1" and c[2] == 0]
+    length = [(b - a) / 1e6 - n[1] for a, b, n in zip(starts, stops, nominal)]
+    start = [a / 1e6 - n[0] for a, n in zip(starts, nominal)]
+    return length, start
+
+
+def print_timing(project, costs):
+    print("%-7s %12s %12s %14s" % ("model", "mean |len|", "max |len|", "drift at end"))
+    for model in MODELS:
+        length, start = timing_error(project, costs, model)
+        print("%-7s %9.3f ms %9.3f ms %11.3f ms"
+              % (model, sum(abs(e) for e in length) / len(length),
+                 max(abs(e) for e in length), start[-1]))
+
+
+# Clock levels of clock_set(): name, FOSC in MHz, supply current in mA running
+# and in IDLE mode. The currents are rough typical figures of the PIC18F26K22 at
+# 3.3 V, replace them with the ones measured on the board.
+CLOCKS = [("low", 1, 0.45, 0.25), ("mid", 16, 3.2, 1.2), ("high", 64, 11.0, 4.0)]
+LOW, MID, HIGH = range(3)
+DENSE_WINDOW = 4  # engine/engine.h
+DENSE_MS = 100
+CLOCK_LEAD_MS = 3
+PLL_LOCK_NS = 2e6  # worst case
+
+
+def clock_plan(events, pos):
+    """Level clock_plan() picks for event pos, at tempo 256/256."""
+    if pos >= len(events):
+        return LOW
+    if events[pos][0] == 0 and events[pos][1] > 2 * CLOCK_LEAD_MS:
+        return LOW
+    notes = [ms for f, ms in events[pos:pos + DENSE_WINDOW] if f]
+    if notes and sum(notes) < DENSE_MS * len(notes):
+        return HIGH
+    return MID
+
+
+def clock_profile(project, costs, scaling=True):
+    """Time (ns) and charge (mA ns) per level, note start latencies (ns)."""
+    events = project.events
+    time = [0.0] * len(CLOCKS)
+    charge = [0.0] * len(CLOCKS)
+    latency = []
+    level = HIGH
+    for i, (frequency, ms) in enumerate(events):
+        wanted = clock_plan(events, i) if scaling else HIGH
+        lock = PLL_LOCK_NS if wanted == HIGH and level != HIGH else 0.0
+        level = wanted
+        following = clock_plan(events, i + 1) if scaling else HIGH
+        # cycles per ms of the event, the per note setup spread over its length
+        cycles = costs["tick_ns"] / CYCLE_NS
+        if frequency:
+            _, offset = project.step_frequency(frequency)
+            cycles += 1e6 / half_period_ns(offset, costs) * costs["isr_ns"] / CYCLE_NS
+            cycles += costs["setup_ns"] / CYCLE_NS / ms
+        segments = [(level, ms)]
+        if following > level and ms >= CLOCK_LEAD_MS:  # clock_ahead()
+            segments = [(level, ms - CLOCK_LEAD_MS), (following, CLOCK_LEAD_MS)]
+        for lv, seg in segments:
+            cycle_ns = 4000.0 / CLOCKS[lv][1]
+            active = min(1.0, cycles * cycle_ns / 1e6)
+            current = active * CLOCKS[lv][2] + (1 - active) * CLOCKS[lv][3]
+            time[lv] += seg * 1e6
+            charge[lv] += seg * 1e6 * current
+        level = segments[-1][0]
+        if frequency:
+            latency.append(lock + costs["setup_ns"] / CYCLE_NS * 4000.0 / CLOCKS[wanted][1])
+    return time, charge, latency
+
+
+def print_power(project, costs):
+    print("%-7s %6s %6s %6s %10s %13s %13s"
+          % ("clock", "low", "mid", "high", "current", "mean latency", "max latency"))
+    for name, scaling in (("fixed", False), ("scaled", True)):
+        time, charge, latency = clock_profile(project, costs, scaling)
+        total = sum(time)
+        print("%-7s %5.1f%% %5.1f%% %5.1f%% %7.2f mA %10.1f us %10.1f us"
+              % ((name,) + tuple(100 * t / total for t in time)
+                 + (sum(charge) / total, sum(latency) / len(latency) / 1e3,
+                    max(latency) / 1e3)))
+
+
+PRIORITIES = 4  # engine/alloc.h
+NO_DRIVE = 0xFF
+POLICIES = {"oldest": 0, "priority": 1, "channel": 2, "bass": 0x80}
+ENGINE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "engine")
+
+
+class DriveT(ctypes.Structure):
+    _fields_ = [("frequency", ctypes.c_uint16), ("channel", ctypes.c_uint8), ("priority", ctypes.c_uint8)]
+
+
+class Allocator:
+    """engine/alloc.c itself, built for the host with gcc for this many drives
+    and the song.h of project, called through ctypes."""
+
+    def __init__(self, drives, policy, project):
+        build = tempfile.mkdtemp(prefix="floppysim")
+        library = os.path.join(build, "alloc.so")
+        subprocess.run(["gcc", "-std=c99", "-O1", "-shared", "-fPIC", "-DDRIVES=%d" % drives,
+                        "-I", project.path, "-I", ENGINE, "-o", library,
+                        os.path.join(ENGINE, "alloc.c")], check=True)
+        self.lib = ctypes.CDLL(library)
+        shutil.rmtree(build)
+        for name in ("alloc_note", "alloc_unison"):
+            getattr(self.lib, name).restype = ctypes.c_uint8
+        self.drives = drives
+        self.drive = (DriveT * drives).in_dll(self.lib, "drive")
+        self.unison_max = min(4, drives)
+        self.lib.alloc_reset(policy)
+
+    @property
+    def stolen(self):
+        return ctypes.c_uint8.in_dll(self.lib, "alloc_stolen").value != 0
+
+    def unison(self, frequency, channel, priority, velocity):
+        """Drives of alloc_unison(), the note's first, [] if dropped."""
+        if self.lib.alloc_unison(frequency, channel, priority, velocity) == NO_DRIVE:
+            return []
+        n = ctypes.c_uint8.in_dll(self.lib, "unison_n").value
+        return list((ctypes.c_uint8 * self.unison_max).in_dll(self.lib, "unison")[:n])
+
+    def release_unison(self, frequency, channel):
+        """Drives alloc_unison_release() set free."""
+        busy = [d.frequency != 0 for d in self.drive]
+        self.lib.alloc_unison_release(frequency, channel)
+        return [d for d in range(self.drives) if busy[d] and self.drive[d].frequency == 0]
+
+
+def allocate(projects, drives, policy, costs):
+    """Notes per drive [(start ns, end ns, channel, frequency)], steals per drive,
+    unison doubles per drive and the dropped notes.
+
+    Project k is channel k; the first one is the lead, priority 3, the others 1.
+    A note keeps its scored end unless the allocator reports it stolen, so a
+    drive handed out twice without a steal shows up as a conflict.
+    """
+    ons, offs = [], []  # (t, on, channel, frequency, velocity, end)
+    for channel, project in enumerate(projects):
+        t = 0.0
+        velocity = 0
+        for i, (frequency, ms) in enumerate(project.events):
+            for name, arg in project.controls.get(i, []):
+                if name == "EV_VELOCITY":
+                    velocity = min(127, arg)
+            if frequency:
+                ons.append((t, 1, channel, frequency, velocity, t + ms * 1e6))
+                offs.append((t + ms * 1e6, 0, channel, frequency, 0, 0))
+            t += ms * 1e6
+    # note offs first at equal times, as the songs release before the next note
+    timeline = sorted(offs + ons)
+    alloc = Allocator(drives, policy, projects[0])
+    played = [[] for _ in range(drives)]
+    stolen = [0] * drives
+    doubled = [0] * drives
+    sounding = {}  # drive -> index in played[drive]
+    dropped = 0
+    for t, on, channel, frequency, velocity, end in timeline:
+        if not on:
+            for d in alloc.release_unison(frequency, channel):
+                if d in sounding and played[d][sounding[d]][2:] == (channel, frequency):
+                    del sounding[d]
+            continue
+        ds = alloc.unison(frequency, channel, PRIORITIES - 1 if channel == 0 else 1, velocity)
+        if not ds:
+            dropped += 1
+            continue
+        if alloc.stolen and ds[0] in sounding:  # the old note stops where the new one starts
+            i = sounding.pop(ds[0])
+            start, _, c, f = played[ds[0]][i]
+            played[ds[0]][i] = (start, t, c, f)
+            stolen[ds[0]] += 1
+        for k, d in enumerate(ds):
+            played[d].append((t, end, channel, frequency))
+            sounding[d] = len(played[d]) - 1
+            doubled[d] += k > 0
+    return played, stolen, doubled, dropped
+
+
+def check_drives(projects, played, costs):
+    """Per drive (notes, busy ns, conflicts): a conflict is a note starting before
+    the last one ended, or two step edges closer than MIN_HALF_PERIOD."""
+    report = []
+    for notes in played:
+        conflicts = 0
+        busy = 0.0
+        last_end = last_edge = -1e18
+        for start, end, channel, frequency in notes:
+            if start < last_end:
+                conflicts += 1
+            busy += end - start
+            _, offset = projects[channel].step_frequency(frequency)
+            period = max(MIN_HALF_PERIOD, 65535 - offset) * TMR1_TICK_NS
+            edge = start + costs["setup_ns"] + period
+            if edge < end and edge - last_edge < MIN_HALF_PERIOD * TMR1_TICK_NS:
+                conflicts += 1
+            while edge < end:
+                last_edge = edge
+                edge += period
+            last_end = end
+        report.append((len(notes), busy, conflicts))
+    return report
+
+
+def print_drives(projects, drives, policy, costs):
+    played, stolen, doubled, dropped = allocate(projects, drives, POLICIES[policy], costs)
+    report = check_drives(projects, played, costs)
+    total = max([n[-1][1] for n in played if n] + [1])
+    print("%-6s %6s %7s %7s %6s %10s" % ("drive", "notes", "unison", "stolen", "busy", "conflicts"))
+    for d, (notes, busy, conflicts) in enumerate(report):
+        print("%-6d %6d %7d %7d %5.1f%% %10d"
+              % (d, notes, doubled[d], stolen[d], 100 * busy / total, conflicts))
+    print("dropped %d notes, policy %s" % (dropped, policy))
+    return sum(r[2] for r in report)
+
+
+# Instruction cycles of ISR() running fanout_tick(), estimated from the XC8
+# code of the loops: context save and latch, one SPI byte at 8 MHz SCK plus the
+# loop, the phase accumulator of one drive, and a half period ending
+FANOUT_CYCLES = {"isr": 40, "byte": 24, "drive": 32, "toggle": 16}
+FANOUT_MIPS = 16.0  # 64 MHz
+
+
+def fanout_tick_cycles(drives, toggles=None):
+    """Worst case cycles of one tick, every drive toggling unless told otherwise."""
+    c = FANOUT_CYCLES
+    nbytes = 2 * ((drives + 7) // 8)
+    toggles = drives if toggles is None else toggles
+    return c["isr"] + nbytes * c["byte"] + drives * c["drive"] + toggles * c["toggle"]
+
+
+def fanout_tick_us(drives):
+    """FANOUT_TICK_US of engine/engine.h: the worst case tick at half the CPU."""
+    return (fanout_tick_cycles(drives) + 7) // 8
+
+
+def print_fanout(project, costs):
+    steps = [1e9 / (2 * half_period_ns(project.step_frequency(f)[1], costs))
+             for f, _ in project.events if f]
+    toggle_hz = 2 * max(steps)
+    print("%-7s %6s %9s %12s %12s %8s %8s"
+          % ("drives", "bytes", "cycles", "max tick", "at 50% CPU", "tick", "jitter"))
+    for drives in (8, 16, 32):
+        cycles = fanout_tick_cycles(drives)
+        rate = FANOUT_MIPS * 1e6 / cycles
+        tick = fanout_tick_us(drives)
+        print("%-7d %6d %9d %8.1f kHz %8.1f kHz %5d us %7.1f%%"
+              % (drives, 2 * ((drives + 7) // 8), cycles, rate / 1e3, rate / 2e3,
+                 tick, 100 * tick * toggle_hz / 1e6))
+    print("%s: fastest half period %.1f us, jitter is the share of it one tick takes"
+          % (project.name, 1e6 / toggle_hz))
+
+
+SIGNALS = ["RA0", "RA1", "RB0", "RB1", "RB2"]
+
+
+def write_vcd(changes, out):
+    ids = {name: chr(ord("!") + i) for i, name in enumerate(SIGNALS)}
+    out.write("$timescale 1 ns $end\n$scope module floppy $end\n")
+    for name in SIGNALS:
+        out.write("$var wire 1 %s %s $end\n" % (ids[name], name))
+    out.write("$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n")
+    for name in SIGNALS:
+        out.write("0%s\n" % ids[name])
+    out.write("$end\n")
+    last = 0
+    for t, name, value in sorted(changes, key=lambda c: c[0]):
+        t = int(round(t))
+        if t != last:
+            out.write("#%d\n" % t)
+            last = t
+        out.write("%d%s\n" % (value, ids[name]))
+
+
+def add_cost_arguments(parser):
+    for key, value in DEFAULTS.items():
+        parser.add_argument("--" + key.replace("_", "-"), type=float, default=value,
+                            help="default %s" % ("per model" if value is None else "%g" % value))
+
+
+def costs_from(args):
+    return {key: getattr(args, key) for key in DEFAULTS}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("project", help="path of a .X project")
+    parser.add_argument("-o", "--output", help="VCD file to write")
+    parser.add_argument("-n", "--limit", type=int, help="simulate the first N events only")
+    parser.add_argument("--notes", action="store_true", help="print the expected notes")
+    parser.add_argument("--timing", action="store_true",
+                        help="note timing error of each duration model")
+    parser.add_argument("--power", action="store_true",
+                        help="clock level share, mean current and note start latency")
+    parser.add_argument("--model", choices=sorted(MODELS), default="tick",
+                        help="duration model of the VCD output")
+    parser.add_argument("--drives", type=int,
+                        help="allocate the notes over this many drives and check them")
+    parser.add_argument("--channel", action="append", default=[], metavar="PROJECT",
+                        help="another .X project played at the same time, channel 1, 2, ...")
+    parser.add_argument("--policy", choices=sorted(POLICIES), default="oldest",
+                        help="note stealing policy of --drives")
+    parser.add_argument("--fanout", action="store_true",
+                        help="shift register tick cost and max tick rate for 8, 16, 32 drives")
+    add_cost_arguments(parser)
+    args = parser.parse_args()
+
+    project = Project(args.project)
+    costs = costs_from(args)
+    if args.notes:
+        events = project.events if args.limit is None else project.events[:args.limit]
+        for i, (frequency, ms) in enumerate(events):
+            if frequency == 0:
+                continue
+            _, offset = project.step_frequency(frequency)
+            print("%5d %6d Hz %7.1f ms  step %9.3f Hz"
+                  % (i, frequency, ms, 1e9 / (2 * half_period_ns(offset, costs))))
+    if args.output:
+        with open(args.output, "w") as out:
+            write_vcd(simulate(project, costs, args.limit, args.model), out)
+    if args.timing:
+        print_timing(project, costs)
+    if args.power:
+        print_power(project, costs)
+    failed = False
+    if args.drives:
+        projects = [project] + [Project(path) for path in args.channel]
+        failed = print_drives(projects, args.drives, args.policy, costs) > 0
+    if args.fanout:
+        print_fanout(project, costs)
+    if not (args.notes or args.output or args.timing or args.power or args.drives or args.fanout):
+        parser.error("nothing to do, give --notes, --timing, --power, --drives, --fanout and/or -o")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+"""Flash and RAM footprint of every project, per component, with budgets.
+
+Reads the XC8 outputs of each project build (dist/<conf>/production/*.map,
+.mum and .lst): the psect lengths and symbols of the map, the memory summary,
+and the "Defined at" note of every function in the listing. Each code psect is
+put in one component:
+
+    song     song[] and any other code or data of the project's own sources
+    engine   the functions and tables of engine/*.c, ISR() included
+    printf   printf(), vfprintf(), the format converters, fputc(), putchar()
+    float    the soft float library (___fladd, ___fldiv, ___xxtofl, ...)
+    runtime  the rest of the C library and the start-up code
+    strings  string literals (smallconst without symbols)
+
+    footprint.py                       # every .X project of the repository
+    footprint.py XP_sounds.X --budget printf=1024
+    footprint.py --save before.json    # then change, rebuild and
+    footprint.py --baseline before.json   # bytes saved per project
+
+Exits 1 when a component goes over its budget, so it can run after a build.
+"""
+
+import argparse
+import glob
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+COMPONENTS = ["song", "engine", "printf", "float", "runtime", "strings"]
+
+# bytes of flash, the PIC18F26K22 has 64 KB
+BUDGETS = {"song": 49152, "engine": 4096, "printf": 1024, "float": 4096,
+           "runtime": 1024, "strings": 512, "total": 65536}
+
+PRINTF = re.compile(r"^_(printf|vfprintf|vfpf\w*|fputc|fputs|putchar|puts|\w*doprnt\w*|[cdilouxf]toa)$")
+FLOAT = re.compile(r"^___\w*(fl|ft)\w*$")
+MARKER = re.compile(r"^__[^_]")  # __Hpsect, __end_of_f, __pintcode, ... but ___fladd
+
+
+def engine_functions():
+    names = set()
+    for path in glob.glob(os.path.join(ROOT, "engine", "*.c")):
+        with open(path) as f:
+            for m in re.finditer(r"^[\w ]+?\b(\w+)\s*\([^;{]*\)\s*\{", f.read(), re.M):
+                names.add("_" + m.group(1))
+    return names
+
+
+def read_map(path):
+    """Psects {name: (start, length, space)} and symbols [(name, psect, address)]."""
+    psects, symbols = {}, []
+    with open(path, encoding="utf-8", errors="replace") as f:
+        text = f.read()
+    total = text.split("TOTAL", 1)[1].split("SEGMENTS", 1)[0]
+    for m in re.finditer(r"^\s+(\w+)\s+([0-9A-F]+)\s+[0-9A-F]+\s+([0-9A-F]+)\s+(\d+)\s*$", total, re.M):
+        psects[m.group(1)] = (int(m.group(2), 16), int(m.group(3), 16), int(m.group(4)))
+    table = text.split("Symbol Table", 1)[1]
+    for m in re.finditer(r"^(\S+)\s+(\w+)\s+([0-9A-F]{6})\s*$", table, re.M):
+        symbols.append((m.group(1), m.group(2), int(m.group(3), 16)))
+    return psects, symbols
+
+
+def read_mum(path):
+    used = {}
+    with open(path) as f:
+        for m in re.finditer(r"^\s+(.+?)\s+used\s+\w+h \(\s*(\d+)\)", f.read(), re.M):
+            used[m.group(1)] = int(m.group(2))
+    return used
+
+
+def library_functions(path):
+    """Functions the listing says are defined in the XC8 sources."""
+    names = set()
+    with open(path, encoding="utf-8", errors="replace") as f:
+        text = f.read()
+    for m in re.finditer(r"\*+ function (\w+) \*+\s*\n[^\n]*\n[^\n]*line \d+ in file \"([^\"]*)\"", text):
+        if re.search(r"[\\/]pic[\\/]sources[\\/]", m.group(2)):
+            names.add(m.group(1))
+    return names
+
+
+def component(name, engine, library):
+    if name in library or name.startswith("___"):
+        if PRINTF.match(name):
+            return "printf"
+        if FLOAT.match(name):
+            return "float"
+        return "runtime"
+    if name in engine or name.startswith("__"):
+        return "engine" if name in engine else "runtime"
+    return "song"
+
+
+def analyze(project, engine):
+    """{component: bytes}, RAM {class: bytes} and the .mum summary of a project."""
+    found = glob.glob(os.path.join(project, "dist", "*", "production", "*.map"))
+    if not found:
+        raise FileNotFoundError("no map under %s/dist, build the project first" % project)
+    base = os.path.splitext(max(found, key=os.path.getmtime))[0]
+    psects, symbols = read_map(base + ".map")
+    library = library_functions(base + ".lst") if os.path.exists(base + ".lst") else set()
+    flash = dict.fromkeys(COMPONENTS, 0)
+    ram = {"stack": 0, "globals": 0}
+    for psect, (start, length, space) in psects.items():
+        if space == 1:
+            ram["stack" if psect.startswith("cstack") else "globals"] += length
+            continue
+        if psect in ("config", "idloc") or psect.startswith("eeprom"):
+            continue
+        inside = sorted((a, s) for s, p, a in symbols
+                        if p == psect and start <= a < start + length and not MARKER.match(s))
+        if psect in ("cinit", "init", "reset_vec", "powerup"):
+            flash["runtime"] += length
+        elif not inside:
+            flash["strings" if "const" in psect else "runtime"] += length
+        else:
+            # one function per text psect, const psects split at their symbols
+            ends = [a for a, _ in inside[1:]] + [start + length]
+            if inside[0][0] > start:
+                flash["strings"] += inside[0][0] - start
+            for (address, name), end in zip(inside, ends):
+                flash[component(name, engine, library)] += end - address
+    return flash, ram, read_mum(base + ".mum")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("projects", nargs="*", help=".X project directories, default all")
+    parser.add_argument("--budget", action="append", default=[], metavar="COMPONENT=BYTES",
+                        help="override a flash budget, COMPONENT is one of %s or total"
+                             % ", ".join(COMPONENTS))
+    parser.add_argument("--save", metavar="FILE", help="write the figures as JSON")
+    parser.add_argument("--baseline", metavar="FILE",
+                        help="JSON of an earlier --save, print the bytes saved since")
+    args = parser.parse_args()
+    budgets = dict(BUDGETS)
+    for item in args.budget:
+        key, value = item.split("=")
+        if key not in budgets:
+            parser.error("unknown component %s" % key)
+        budgets[key] = int(value)
+    projects = args.projects or sorted(glob.glob(os.path.join(ROOT, "*.X")))
+    engine = engine_functions()
+
+    over = []
+    figures = {}
+    print("%-46s %6s %6s %6s %6s %7s %7s %6s %5s %5s %7s"
+          % (("project",) + tuple(COMPONENTS) + ("flash", "RAM", "stack", "glob")))
+    for project in projects:
+        name = os.path.basename(os.path.normpath(project))
+        flash, ram, mum = analyze(project, engine)
+        total = mum.get("Program space", sum(flash.values()))
+        figures[name] = dict(flash, flash=total, ram=mum.get("Data space", 0))
+        print("%-46s %6d %6d %6d %6d %7d %7d %6d %5d %5d %7d"
+              % ((name[:46],) + tuple(flash[c] for c in COMPONENTS)
+                 + (total, mum.get("Data space", 0), ram["stack"], ram["globals"])))
+        for key in COMPONENTS:
+            if flash[key] > budgets[key]:
+                over.append("%s: %s %d bytes, budget %d" % (name, key, flash[key], budgets[key]))
+        if total > budgets["total"]:
+            over.append("%s: flash %d bytes, budget %d" % (name, total, budgets["total"]))
+    if args.baseline:
+        with open(args.baseline) as f:
+            before = json.load(f)
+        keys = COMPONENTS + ["flash", "ram"]
+        print("\nsaved since %s" % args.baseline)
+        print("%-46s" % "project" + "".join(" %7s" % k for k in keys))
+        for name in sorted(set(before) & set(figures)):
+            print("%-46s" % name[:46]
+                  + "".join(" %7d" % (before[name][k] - figures[name][k]) for k in keys))
+    if args.save:
+        with open(args.save, "w") as f:
+            json.dump(figures, f, indent=1, sort_keys=True)
+    for line in over:
+        print("over budget, " + line)
+    return 1 if over else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
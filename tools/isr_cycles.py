@@ -0,0 +1,296 @@
+#!/usr/bin/env python3
+"""Static cycle count of the interrupt vectors in an XC8 listing.
+
+Reads the .lst of a build (dist/<conf>/production/*.lst), decodes the PIC18
+opcodes it lists and walks every path from the interrupt vectors (0x0008 high,
+0x0018 low priority) to RETFIE, following calls, so the compiler's context
+save and restore are counted too. For each vector it reports the best and
+worst case cycles, and the cycles from the interrupt request to the first
+write of LATA (the step and direction edges of the drive).
+
+    isr_cycles.py XP_sounds.X               # newest listing of the project
+    isr_cycles.py build.lst --budget 60     # exit 1 if an edge can be later
+
+A loop on a path has no static bound, so a high priority vector with one is
+reported as "-" and fails the check. The routines of BOUNDS are the exception:
+a call to fanout_tick(), with its per drive loop and BF wait, costs the
+FANOUT_CYCLES of engine.h for the FANOUT_DRIVES of the project macros
+(nbproject/configurations.xml, or -D). Its step edges are then on the latch
+of the chain rather than on LATA, so such a build is checked against the
+FANOUT_TICK_US period instead of --budget:
+
+    isr_cycles.py build.lst -D FANOUT_DRIVES=16
+
+The opcodes are decoded rather than the mnemonics, because some XC8 versions
+print the source text one line off the code it belongs to.
+"""
+
+import argparse
+import glob
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+ENTRY_CYCLES = 3  # interrupt request to the first vector instruction
+VECTORS = [("high", 0x0008), ("low", 0x0018)]
+LATA = 0xF89
+
+LINE = re.compile(r"^\s*\d+\s+([0-9A-F]{6})\s+([0-9A-F]{4})(?:\s+([0-9A-F]{4}))?(?:\s|$)")
+LABEL = re.compile(r"^\s*\d+\s+([0-9A-F]{6})\s+(\w+):\s*$")
+
+
+def fanout_cycles(macros):
+    """FANOUT_CYCLES of engine/engine.h, None without fan-out."""
+    drives = int(macros.get("FANOUT_DRIVES", 0))
+    if not drives:
+        return None
+    return 40 + 2 * ((drives + 7) // 8) * 24 + drives * 48
+
+
+def fanout_tick_us(macros):
+    """FANOUT_TICK_US of engine/engine.h, 0 without fan-out."""
+    if not int(macros.get("FANOUT_DRIVES", 0)):
+        return 0
+    return int(macros.get("FANOUT_TICK_US", (fanout_cycles(macros) + 7) // 8))
+
+
+# Routines with loops, by label, and their worst case cycles from the macros
+BOUNDS = {"_fanout_tick": fanout_cycles}
+
+
+def read_listing(path):
+    """Program words by address, the first listing of an address wins."""
+    code = {}
+    with open(path, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            m = LINE.match(line)
+            if not m:
+                continue
+            address = int(m.group(1), 16)
+            words = [int(m.group(2), 16)] + ([int(m.group(3), 16)] if m.group(3) else [])
+            code.setdefault(address, words)
+    return code
+
+
+def read_labels(path):
+    """Addresses of the labels of a listing."""
+    labels = {}
+    with open(path, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            m = LABEL.match(line)
+            if m:
+                labels.setdefault(m.group(2), int(m.group(1), 16))
+    return labels
+
+
+def project_macros(listing, conf=None):
+    """define-macros of the project a dist/<conf>/<type>/*.lst belongs to."""
+    parts = os.path.abspath(listing).split(os.sep)
+    if len(parts) < 5 or parts[-4] != "dist":
+        return {}
+    path = os.path.join(os.sep.join(parts[:-4]), "nbproject", "configurations.xml")
+    if not os.path.isfile(path):
+        return {}
+    macros = {}
+    for c in ET.parse(path).getroot().iter("conf"):
+        if c.get("name") != (conf or parts[-3]):
+            continue
+        for p in c.iter("property"):
+            if p.get("key") == "define-macros" and p.get("value"):
+                for m in p.get("value").split(";"):
+                    name, _, value = m.partition("=")
+                    macros[name.strip()] = value.strip() or "1"
+    return macros
+
+
+def signed(value, bits):
+    return value - (1 << bits) if value & (1 << (bits - 1)) else value
+
+
+class Insn:
+    """One decoded instruction: size in bytes, cycles, control flow, LATA write."""
+
+    def __init__(self, address, code):
+        w = code[address][0]
+        second = code[address][1] if len(code[address]) > 1 else code.get(address + 2, [0])[0]
+        self.address = address
+        self.size = 2
+        self.cycles = 1
+        self.kind = "next"  # next, skip, branch (conditional), jump, call, return, stop
+        self.target = None
+        self.writes_lata = False
+        top = w >> 8
+        access_sfr = lambda: not (w & 0x100) and (w & 0xFF) >= 0x60
+        if w in (0x0010, 0x0011, 0x0012, 0x0013) or top == 0x0C:  # retfie, return, retlw
+            self.kind, self.cycles = "return", 2
+        elif w == 0x0003 or w == 0x00FF:  # sleep, reset
+            self.kind = "stop"
+        elif 0x0008 <= w <= 0x000F:  # tblrd, tblwt
+            self.cycles = 2
+        elif 0x04 <= top <= 0x07 or 0x10 <= top <= 0x6F:  # byte oriented file register operations
+            op = w >> 10
+            if op in (0x0B, 0x0F, 0x12, 0x13) or (w >> 9) in (0x30, 0x31, 0x32, 0x33):
+                self.kind = "skip"  # decfsz, incfsz, infsnz, dcfsnz, cpfslt/eq/gt, tstfsz
+            writes = (w >> 9) in (0x34, 0x35, 0x36, 0x37)  # setf, clrf, negf, movwf
+            writes = writes or ((w & 0x200) and op not in (0x18, 0x19) and (w >> 9) not in (0x30, 0x31, 0x32, 0x33))
+            self.writes_lata = bool(writes) and access_sfr() and 0xF00 | (w & 0xFF) == LATA
+        elif 0x7 <= w >> 12 <= 0x9:  # btg, bsf, bcf
+            self.writes_lata = access_sfr() and 0xF00 | (w & 0xFF) == LATA
+        elif 0xA <= w >> 12 <= 0xB:  # btfss, btfsc
+            self.kind = "skip"
+        elif w >> 12 == 0xC:  # movff
+            self.size, self.cycles = 4, 2
+            self.writes_lata = second & 0xFFF == LATA
+        elif w >> 11 == 0x1A:  # bra
+            self.kind, self.cycles = "jump", 2
+            self.target = address + 2 + 2 * signed(w & 0x7FF, 11)
+        elif w >> 11 == 0x1B:  # rcall
+            self.kind, self.cycles = "call", 2
+            self.target = address + 2 + 2 * signed(w & 0x7FF, 11)
+        elif 0xE0 <= top <= 0xE7:  # bz, bnz, bc, bnc, bov, bnov, bn, bnn
+            self.kind = "branch"
+            self.target = address + 2 + 2 * signed(w & 0xFF, 8)
+        elif top in (0xEC, 0xED, 0xEF):  # call, goto
+            self.size, self.cycles = 4, 2
+            self.kind = "jump" if top == 0xEF else "call"
+            self.target = (((second & 0xFFF) << 8) | (w & 0xFF)) * 2
+        elif top == 0xEE:  # lfsr
+            self.size, self.cycles = 4, 2
+
+
+class Walker:
+    """Best and worst cycles of every path from an address to its return."""
+
+    def __init__(self, code, bounds=None):
+        self.code = code
+        self.bounds = bounds or {}  # routine address: worst case cycles
+        self.memo = {}
+        self.visited = set()
+
+    def insn(self, address):
+        if address not in self.code:
+            raise ValueError("no code listed at 0x%04X" % address)
+        return Insn(address, self.code)
+
+    def paths(self, address, stack=(), seen=frozenset(), callers=()):
+        """(cycles, edge) pairs per path, edge = cycles up to the first LATA write.
+        seen holds the addresses of the routine running, callers those of the
+        routines it returns to, so a routine called twice is not a loop."""
+        key = (address, stack)
+        if key in self.memo:
+            return self.memo[key]
+        if address in seen:
+            raise ValueError("loop at 0x%04X, no static bound" % address)
+        seen = seen | {address}
+        self.visited.add(address)
+        i = self.insn(address)
+        follow = []  # (extra cycles, address, stack, seen, callers)
+        if i.kind == "next":
+            follow.append((0, address + i.size, stack, seen, callers))
+        elif i.kind == "skip":
+            after = address + i.size
+            follow.append((0, after, stack, seen, callers))
+            follow.append((self.insn(after).size // 2, after + self.insn(after).size, stack, seen, callers))
+        elif i.kind == "branch":
+            follow.append((0, address + i.size, stack, seen, callers))
+            follow.append((1, i.target, stack, seen, callers))
+        elif i.kind == "jump":
+            follow.append((0, i.target, stack, seen, callers))
+        elif i.kind == "call" and i.target in self.bounds:
+            follow.append((self.bounds[i.target], address + i.size, stack, seen, callers))
+        elif i.kind == "call":
+            if any(i.target in s for s in callers + (seen,)):
+                raise ValueError("recursive call of 0x%04X, no static bound" % i.target)
+            follow.append((0, i.target, stack + (address + i.size,), frozenset(), callers + (seen,)))
+        elif i.kind == "return" and stack:
+            follow.append((0, stack[-1], stack[:-1], callers[-1], callers[:-1]))
+        result = set()
+        if not follow:
+            result.add((i.cycles, i.cycles if i.writes_lata else None))
+        for extra, target, next_stack, next_seen, next_callers in follow:
+            for cycles, edge in self.paths(target, next_stack, next_seen, next_callers):
+                here = i.cycles + extra
+                if i.writes_lata:
+                    edge = i.cycles
+                elif edge is not None:
+                    edge += here
+                result.add((here + cycles, edge))
+        self.memo[key] = result
+        return result
+
+
+def find_listing(path):
+    if os.path.isfile(path):
+        return path
+    found = glob.glob(os.path.join(path, "dist", "*", "*", "*.lst"))
+    if not found:
+        raise FileNotFoundError("no listing under %s/dist, build the project first" % path)
+    return max(found, key=os.path.getmtime)
+
+
+def analyze(path, macros=None):
+    """Per vector: (name, best, worst, best edge, worst edge), None if unused
+    or, for all but the name, if the vector has a loop outside BOUNDS."""
+    code = read_listing(path)
+    labels = read_labels(path)
+    macros = macros or {}
+    bounds = {labels[n]: f(macros) for n, f in BOUNDS.items() if n in labels}
+    walker = Walker(code, {a: c for a, c in bounds.items() if c is not None})
+    report = []
+    for name, vector in VECTORS:
+        if vector not in code or vector in walker.visited:
+            continue  # without IPEN the high priority ISR() runs over 0x0018
+        try:
+            paths = walker.paths(vector)
+        except ValueError as e:
+            print("%s: %s vector: %s" % (os.path.basename(path), name, e))
+            report.append((name, None, None, None, None))
+            continue
+        cycles = [c + ENTRY_CYCLES for c, _ in paths]
+        edges = [e + ENTRY_CYCLES for _, e in paths if e is not None]
+        report.append((name, min(cycles), max(cycles),
+                       min(edges) if edges else None, max(edges) if edges else None))
+    return report
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("paths", nargs="+", help=".lst files or .X project directories")
+    parser.add_argument("--budget", type=int,
+                        help="worst high priority LATA edge latency allowed, in cycles")
+    parser.add_argument("-D", dest="defines", action="append", default=[], metavar="NAME=VALUE",
+                        help="project macro, over the ones of nbproject/configurations.xml")
+    args = parser.parse_args()
+
+    failed = False
+    print("%-44s %-5s %6s %6s %10s %10s" % ("listing", "ISR", "best", "worst", "edge best", "edge worst"))
+    for path in args.paths:
+        listing = find_listing(path)
+        macros = project_macros(listing)
+        for d in args.defines:
+            name, _, value = d.partition("=")
+            macros[name] = value or "1"
+        tick = fanout_tick_us(macros)
+        for name, best, worst, edge_best, edge_worst in analyze(listing, macros):
+            print("%-44s %-5s %6s %6s %10s %10s"
+                  % (os.path.basename(listing)[:44], name, "-" if best is None else best,
+                     "-" if worst is None else worst,
+                     "-" if edge_best is None else edge_best, "-" if edge_worst is None else edge_worst))
+            if name == "high" and worst is None:
+                print("high priority ISR has no static bound, its step edges can come at any time")
+                failed = True
+            elif name == "high" and tick:
+                if worst > tick * 16 * 3 // 4:  # 16 cycles per us, a quarter left to main()
+                    print("high priority ISR of %d cycles leaves less than a quarter of the %d us fan-out tick"
+                          % (worst, tick))
+                    failed = True
+            elif name == "high" and args.budget is not None and edge_worst is not None \
+                    and edge_worst > args.budget:
+                print("step edge latency %d cycles exceeds the budget of %d" % (edge_worst, args.budget))
+                failed = True
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""Decode the binary event trace of a TRACE build into a timeline.
+
+The firmware interleaves 7 byte records with the console text on the UART:
+
+    0xA5, type, time lo, time hi, arg lo, arg hi, xor of the 5 previous bytes
+
+time is Timer0 at 4 us per count. It wraps every 262 ms; the firmware emits a
+WRAP record on every overflow so the host can rebuild an absolute timeline.
+
+    trace_decode.py capture.bin          # file saved by a serial terminal
+    trace_decode.py /dev/ttyUSB0 -b 19200  # live, needs pyserial
+"""
+
+import argparse
+import sys
+
+SYNC = 0xA5
+TICK_US = 4
+WRAP_TICKS = 1 << 16
+
+EVENTS = {
+    1: "note on",
+    2: "note off",
+    3: "direction",
+    4: "reload",
+    5: "rx",
+    6: "wrap",
+    7: "lost",
+}
+
+
+def records(data):
+    """Yield (type, time, arg) for every valid record, skipping console text."""
+    i = 0
+    while i + 7 <= len(data):
+        if data[i] != SYNC or data[i + 1] not in EVENTS:
+            i += 1
+            continue
+        body = data[i + 1:i + 6]
+        check = 0
+        for b in body:
+            check ^= b
+        if check != data[i + 6]:
+            i += 1
+            continue
+        yield body[0], body[1] | body[2] << 8, body[3] | body[4] << 8
+        i += 7
+
+
+def timeline(recs):
+    """Yield (absolute us, type, arg) unwrapping the 16 bit time."""
+    base = 0
+    last = None
+    for kind, time, arg in recs:
+        if last is not None and time < last:
+            base += WRAP_TICKS
+        last = time
+        yield (base + time) * TICK_US, kind, arg
+
+
+def describe(kind, arg):
+    if kind == 1:
+        return "%d Hz" % arg
+    if kind == 3:
+        return "LA1=%d" % (arg & 1)
+    if kind == 4:
+        return "TMR1=0x%04X (%d us half period)" % (arg, (0x10000 - arg) // 2)
+    if kind == 5:
+        return repr(chr(arg & 0xFF))
+    if kind == 7:
+        return "%d records" % arg
+    return ""
+
+
+def read_input(args):
+    if args.source.startswith("/dev/") or args.source.upper().startswith("COM"):
+        import serial  # pyserial, only needed for live capture
+        port = serial.Serial(args.source, args.baud, timeout=1)
+        data = bytearray()
+        try:
+            while True:
+                data += port.read(256)
+        except KeyboardInterrupt:
+            pass
+        return bytes(data)
+    with open(args.source, "rb") as f:
+        return f.read()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("source", help="capture file or serial port")
+    parser.add_argument("-b", "--baud", type=int, default=19200)
+    parser.add_argument("--no-reload", action="store_true",
+                        help="hide the per edge period reload records")
+    args = parser.parse_args()
+
+    count = 0
+    prev_us = None
+    for us, kind, arg in timeline(records(read_input(args))):
+        count += 1
+        if kind == 6 or (args.no_reload and kind == 4):
+            continue
+        delta = 0 if prev_us is None else us - prev_us
+        prev_us = us
+        print("%12.3f ms  %+10.3f ms  %-9s %s"
+              % (us / 1000.0, delta / 1000.0, EVENTS[kind], describe(kind, arg)))
+    if count == 0:
+        print("no trace records found", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""Measure a logic analyzer capture of the floppy player.
+
+Takes a VCD file (sigrok: `sigrok-cli ... -O vcd`, or tools/floppysim.py) with
+the drive lines RA0 (step) and RA1 (direction) and, from a PROBE build, RB0
+(high inside ISR()), RB1 (high while a note sounds) and RB2 (direction flip).
+Reports the measured step frequency of every note, the ISR duty cycle and the
+gaps between notes.
+
+    vcd_probe.py capture.vcd
+    vcd_probe.py capture.vcd --map step=D0,dir=D1,isr=D2,note=D3,flip=D4
+
+Without a note channel, notes are split where the step line is quiet for more
+than --gap-ms.
+"""
+
+import argparse
+import sys
+
+UNITS = {"s": 1e9, "ms": 1e6, "us": 1e3, "ns": 1.0, "ps": 1e-3, "fs": 1e-6}
+ROLES = {"step": "RA0", "dir": "RA1", "isr": "RB0", "note": "RB1", "flip": "RB2"}
+
+
+def parse_vcd(path):
+    """Return {signal name: [(time ns, value), ...]} for the 1 bit signals."""
+    names = {}
+    changes = {}
+    scale = 1.0
+    t = 0.0
+    with open(path) as f:
+        tokens = iter(f.read().split())
+    for tok in tokens:
+        if tok == "$timescale":
+            spec = ""
+            for part in tokens:
+                if part == "$end":
+                    break
+                spec += part
+            number = spec.rstrip("munpfs")
+            scale = float(number or 1) * UNITS[spec[len(number):]]
+        elif tok == "$var":
+            fields = []
+            for part in tokens:
+                if part == "$end":
+                    break
+                fields.append(part)
+            if fields[1] == "1":
+                names[fields[2]] = fields[3]
+                changes[fields[3]] = []
+        elif tok.startswith("#"):
+            t = float(tok[1:]) * scale
+        elif tok[0] in "01xXzZ" and tok[1:] in names:
+            value = 1 if tok[0] == "1" else 0
+            trace = changes[names[tok[1:]]]
+            if not trace or trace[-1][1] != value:
+                trace.append((t, value))
+        elif tok[0] in "bBrR":
+            next(tokens)  # vector value, not used
+    return changes
+
+
+def high_intervals(trace, end):
+    """[(start, stop)] of the periods where the signal is 1."""
+    out = []
+    start = None
+    for t, v in trace:
+        if v and start is None:
+            start = t
+        elif not v and start is not None:
+            out.append((start, t))
+            start = None
+    if start is not None:
+        out.append((start, end))
+    return out
+
+
+def rising(trace):
+    return [t for t, v in trace if v]
+
+
+def split_notes(edges, gap_ns):
+    """Group step edges into notes where they are closer than gap_ns."""
+    notes = []
+    start = prev = None
+    for t in edges:
+        if start is None:
+            start = t
+        elif t - prev > gap_ns:
+            notes.append((start, prev))
+            start = t
+        prev = t
+    if start is not None:
+        notes.append((start, prev))
+    return notes
+
+
+def measure(changes, roles, gap_ms):
+    step = changes.get(roles["step"])
+    if not step:
+        raise SystemExit("no step channel %s in the capture" % roles["step"])
+    end = max(trace[-1][0] for trace in changes.values() if trace)
+    edges = rising(step)
+    note_trace = changes.get(roles["note"])
+    if note_trace:
+        notes = high_intervals(note_trace, end)
+    else:
+        notes = split_notes(edges, gap_ms * 1e6)
+
+    report = {"notes": [], "gaps": [], "end": end}
+    i = 0
+    for start, stop in notes:
+        while i < len(edges) and edges[i] < start:
+            i += 1
+        j = i
+        while j < len(edges) and edges[j] <= stop:
+            j += 1
+        n = j - i
+        freq = (n - 1) * 1e9 / (edges[j - 1] - edges[i]) if n > 1 else 0.0
+        report["notes"].append((start, stop - start, n, freq))
+        i = j
+    for (_, a), (b, _) in zip(notes, notes[1:]):
+        report["gaps"].append(b - a)
+
+    isr = changes.get(roles["isr"])
+    if isr:
+        widths = [b - a for a, b in high_intervals(isr, end)]
+        report["isr"] = (sum(widths) / end if end else 0.0,
+                         min(widths) if widths else 0.0,
+                         max(widths) if widths else 0.0, len(widths))
+    flips = changes.get(roles["flip"]) or changes.get(roles["dir"]) or []
+    report["flips"] = len(rising(flips)) if roles["flip"] in changes else max(len(flips) - 1, 0)
+    return report
+
+
+def print_report(report):
+    print("%5s %12s %10s %7s %12s" % ("note", "start ms", "length ms", "steps", "step Hz"))
+    for k, (start, length, n, freq) in enumerate(report["notes"]):
+        print("%5d %12.3f %10.3f %7d %12.3f" % (k, start / 1e6, length / 1e6, n, freq))
+    gaps = report["gaps"]
+    if gaps:
+        print("inter-note gap ms: min %.3f  max %.3f  mean %.3f"
+              % (min(gaps) / 1e6, max(gaps) / 1e6, sum(gaps) / len(gaps) / 1e6))
+    if "isr" in report:
+        duty, lo, hi, n = report["isr"]
+        print("ISR: %d calls, duty %.3f%%, width min %.3f us max %.3f us"
+              % (n, duty * 100, lo / 1e3, hi / 1e3))
+    print("direction flips: %d" % report["flips"])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("capture", help="VCD file")
+    parser.add_argument("--map", default="",
+                        help="channel names, e.g. step=D0,dir=D1,isr=D2,note=D3,flip=D4")
+    parser.add_argument("--gap-ms", type=float, default=20.0,
+                        help="quiet time that ends a note without a note channel")
+    args = parser.parse_args()
+
+    roles = dict(ROLES)
+    for item in filter(None, args.map.split(",")):
+        role, name = item.split("=")
+        roles[role] = name
+    print_report(measure(parse_vcd(args.capture), roles, args.gap_ms))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())